@@ -20,13 +20,13 @@ void printState(real_t time, CoreShellDiffusion &particle);
 int main(int argc, char const *argv[])
 {
 	
-    CoreShellDiffusion::setUpRadiusArray();
+	SimulationConfig config;
 
-    CoreShellDiffusion Ni_clad_Al_particle;
+    CoreShellDiffusion Ni_clad_Al_particle(config);
 
     real_t temperature = 1900;
 
-    size_t step = 0.001 / CoreShellDiffusion::delta_t;
+    size_t step = 0.001 / Ni_clad_Al_particle.delta_t;
 
 	real_t time = 0.0;
 
@@ -43,7 +43,7 @@ int main(int argc, char const *argv[])
 			Ni_clad_Al_particle.setUpEquations(temperature);
 			Ni_clad_Al_particle.solveEquations();
 
-			time += CoreShellDiffusion::delta_t;
+			time += Ni_clad_Al_particle.delta_t;
 
 			combustion_complete = Ni_clad_Al_particle.isCombustionComplete();           
 		}
@@ -53,8 +53,6 @@ int main(int argc, char const *argv[])
 		printState(time, Ni_clad_Al_particle);
 	}
 
-	CoreShellDiffusion::deallocateRadiusArray();
-	
     return 0;
 }
 
@@ -64,7 +62,7 @@ void printState(real_t time, CoreShellDiffusion &particle)
     real_t m_Ni = particle.getAtomMassB();
     real_t m = m_Al + m_Ni;
 
-	static const real_t initial_mass = CoreShellParticle::mass;
+	const real_t initial_mass = particle.config.particle_mass;
 
 	std::cout << "Time : " << time << "\ts";
 
@@ -12,9 +12,9 @@ void printState(size_t iteration_number, PelletFlamePropagation &pellet);
 
 int main(int argc, char const *argv[])
 {
-    CoreShellDiffusion::setUpRadiusArray();
+	SimulationConfig config;
 
-    PelletFlamePropagation combustion_pellet(0.8);
+    PelletFlamePropagation combustion_pellet(config, 0.8);
    
     combustion_pellet.initializePellet(1900, 0.1);
 
@@ -64,8 +64,6 @@ int main(int argc, char const *argv[])
     combustion_pellet.printTemperatureProfile(temperature_file, ',');
     temperature_file.close();
 
-	CoreShellDiffusion::deallocateRadiusArray();
-
     return 0;
 }
 
@@ -2,9 +2,7 @@
 #include "thermo-physical-properties/Condensed-Species.hpp"
 #include "utilities/Read-Data.hpp"
 
-const real_t Phase::sharpness_coefficient = 0.1;
-
-CondensedSpecies nickel = readCondensedSpeciesData("data/species/nickel");
+CondensedSpecies nickel = readCondensedSpeciesData("data/species/nickel", 0.1);
 
 int main(int argc, char const *argv[])
 {
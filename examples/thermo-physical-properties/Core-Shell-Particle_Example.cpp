@@ -15,7 +15,9 @@
 
 int main(int argc, char const *argv[])
 {
-    CoreShellParticle Ni_clad_Al_particle;
+	SimulationConfig config;
+
+    CoreShellParticle Ni_clad_Al_particle(config);
 
 	real_t temperature;
 
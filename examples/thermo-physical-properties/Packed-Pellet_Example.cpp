@@ -4,7 +4,9 @@
 
 int main(int argc, char const *argv[])
 {
-	PackedPellet pellet(0.5);
+	SimulationConfig config;
+
+	PackedPellet pellet(config, 0.5);
     
     std::cout << "Overall Particle Density :\t" << pellet.overall_particle_density << "\tkg/m3" << std::endl;
 
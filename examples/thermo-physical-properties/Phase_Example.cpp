@@ -3,11 +3,9 @@
 #include "thermo-physical-properties/Phase.hpp"
 #include "utilities/Read-Data.hpp"
 
-const real_t Phase::sharpness_coefficient = 0.1;
-
 int main(int argc, char const *argv[])
 {
-	Phase nickel_solid_1 = readPhaseData("data/species/nickel/solid-1");
+	Phase nickel_solid_1 = readPhaseData("data/species/nickel/solid-1", 0.1);
 
 	real_t temperature;
 	
@@ -39,7 +39,24 @@ class LUSolver
 		// and simultaneously perform forward substitution
 		inline void LU_DecompositionAndForwardSubstitution()
 		{
-			for (int i=1; i<_n; i++)
+			decomposeAndForwardSubstitute(1, _n);
+		}
+
+	public:
+
+		LUSolver(unsigned int N);
+
+		~LUSolver();
+
+		// Returns bytes allocated by a solver of n equations
+		static size_t getAllocatedBytes(unsigned int n);
+
+		// Decomposes rows # begin to end - 1 of the matrix with forward substitution,
+		// begin being at least 1. Rows up to begin - 1 must have been done before,
+		// so that doing consecutive ranges of rows equals doing all rows at once.
+		inline void decomposeAndForwardSubstitute(unsigned int begin, unsigned int end)
+		{
+			for (int i=begin; i<end; i++)
 			{
 				// L[i][i-1] = A[i][i-1] / U[i-1][i-1]
 				_lower_matrix_off_diagonal_element = _A(i, i-1) / _U(i-1, i-1);
@@ -54,11 +71,21 @@ class LUSolver
 			}
 		}
 
-	public:
+		// Solves for x[begin] to x[end - 1] by backward substitution, after all rows are
+		// decomposed. x[end] must have been solved before unless end is n, so that
+		// consecutive ranges of rows from the last to the first equal solving all at once.
+		inline void backSubstitute(real_t *x, unsigned int begin, unsigned int end)
+		{
+			if (end == _n)
+			{
+				x[_n-1] = _d[_n-1] / _U(_n-1, _n-1);
+				end--;
+			}
 
-		LUSolver(unsigned int N);
+			for (int i=(int)end-1; i>=(int)begin; i--)
 
-		~LUSolver();
+				x[i] = ( _d[i] - _U(i, i+1) * x[i+1] ) / _U(i, i);
+		}
 
 		// Set up equation represented by ith row of the matrix equation, i.e.,
 		// e * x[i+1] + f * x[i] + g * x[i-1] = b
@@ -152,12 +179,7 @@ class LUSolver
 		{
 			LU_DecompositionAndForwardSubstitution();
 
-			// Backward substitution
-			x[_n-1] = _d[_n-1] / _U(_n-1, _n-1);
-
-			for (int i=_n-2; i>=0; i--)
-
-				x[i] = ( _d[i] - _U(i, i+1) * x[i+1] ) / _U(i, i);
+			backSubstitute(x, 0, _n);
 		}
 
 		// Solve the matrix equation and store it to array x
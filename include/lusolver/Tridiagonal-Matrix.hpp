@@ -1,6 +1,8 @@
 #ifndef __TRIDIAGONAL_MATRIX__
 #define __TRIDIAGONAL_MATRIX__
 
+#include <cstddef>
+
 #include "math/Data-Type.hpp"
 
 class TridiagonalMatrix
@@ -45,6 +47,9 @@ class TridiagonalMatrix
 		
 		~TridiagonalMatrix();
 
+		// Returns bytes allocated by a matrix of size n
+		static size_t getAllocatedBytes(unsigned int n);
+
 		// i - row index
 		// j - column index
 		// i and j start from 0 to _n-1
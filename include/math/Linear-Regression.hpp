@@ -0,0 +1,138 @@
+#ifndef __LINEAR_REGRESSION__
+#define __LINEAR_REGRESSION__
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include "math/Data-Type.hpp"
+
+// Least squares line through points added one at a time, in constant memory.
+// Coordinates are taken relative to the first point to keep the sums well conditioned.
+class LinearRegression
+{
+	private:
+
+		real_t _x_0;
+		real_t _y_0;
+
+		real_t _sum_x;
+		real_t _sum_y;
+		real_t _sum_xx;
+		real_t _sum_xy;
+		real_t _sum_yy;
+
+		size_t _number_of_points;
+
+		// Sum of squares of deviations of x from its mean
+		inline real_t getSxx() const
+		{
+			return _sum_xx - _sum_x * _sum_x / (real_t) _number_of_points;
+		}
+
+		inline real_t getSxy() const
+		{
+			return _sum_xy - _sum_x * _sum_y / (real_t) _number_of_points;
+		}
+
+		inline real_t getSyy() const
+		{
+			return _sum_yy - _sum_y * _sum_y / (real_t) _number_of_points;
+		}
+
+	public:
+
+		LinearRegression() { reset(); }
+
+		inline void reset()
+		{
+			_x_0 = _y_0 = 0;
+
+			_sum_x = _sum_y = _sum_xx = _sum_xy = _sum_yy = 0;
+
+			_number_of_points = 0;
+		}
+
+		inline void addPoint(real_t x, real_t y)
+		{
+			if (_number_of_points == 0)
+			{
+				_x_0 = x;
+				_y_0 = y;
+			}
+
+			x -= _x_0;
+			y -= _y_0;
+
+			_sum_x	+= x;
+			_sum_y	+= y;
+			_sum_xx	+= x * x;
+			_sum_xy	+= x * y;
+			_sum_yy	+= y * y;
+
+			_number_of_points++;
+		}
+
+		// Writes the sums in binary, to continue the fit after readState
+		inline void writeState(std::ostream &output_stream) const
+		{
+			const real_t values[7] = {_x_0, _y_0, _sum_x, _sum_y, _sum_xx, _sum_xy, _sum_yy};
+			const std::uint64_t number_of_points = _number_of_points;
+
+			output_stream.write((const char *) values, sizeof(values));
+			output_stream.write((const char *) &number_of_points, sizeof(number_of_points));
+		}
+
+		inline void readState(std::istream &input_stream)
+		{
+			real_t values[7];
+			std::uint64_t number_of_points;
+
+			input_stream.read((char *) values, sizeof(values));
+			input_stream.read((char *) &number_of_points, sizeof(number_of_points));
+
+			_x_0	= values[0];
+			_y_0	= values[1];
+			_sum_x	= values[2];
+			_sum_y	= values[3];
+			_sum_xx	= values[4];
+			_sum_xy	= values[5];
+			_sum_yy	= values[6];
+
+			_number_of_points = number_of_points;
+		}
+
+		inline size_t getNumberOfPoints() const
+		{
+			return _number_of_points;
+		}
+
+		// Returns slope of the line, NAN if fewer than two points
+		// with distinct x have been added
+		inline real_t getSlope() const
+		{
+			if (_number_of_points < 2 || getSxx() <= 0) return NAN;
+
+			return getSxy() / getSxx();
+		}
+
+		// Returns standard error of the slope estimated from the scatter
+		// of the points about the line, NAN if fewer than three points
+		inline real_t getSlopeStandardError() const
+		{
+			if (_number_of_points < 3 || getSxx() <= 0) return NAN;
+
+			real_t slope = getSlope();
+
+			real_t residual_sum_of_squares = getSyy() - slope * getSxy();
+
+			// Guard against round off in nearly exact fits
+			if (residual_sum_of_squares < 0) residual_sum_of_squares = 0;
+
+			return std::sqrt(residual_sum_of_squares / ((real_t) _number_of_points - 2) / getSxx());
+		}
+};
+
+#endif
\ No newline at end of file
@@ -76,6 +76,32 @@ class ShomateExpression
 			;
 		}
 
+		// Expects input as T(K)/1000
+		// Evaluates both the expression (J/mol.-K) and its integral (kJ/mol.)
+		// sharing the powers of x between them
+		inline void evaluateExpressionAndIntegral(real_t x, real_t &expression, real_t &integral) const
+		{
+			real_t x_2 = std::pow(x, 2);
+			real_t x_3 = std::pow(x, 3);
+
+			expression =
+				_A +
+				_B * x +
+				_C * x_2 +
+				_D * x_3 +
+				_E * std::pow(x,-2)
+			;
+
+			integral =
+				_A * x +
+				_integral_B * x_2 +
+				_integral_C * x_3 +
+				_integral_D * std::pow(x, 4) -
+				_E / x +
+				_F
+			;
+		}
+
 		// Converts to SI units
 		// kJ/mol. -> J/mol.
 		inline static real_t normalizeIntegralOutput(real_t h)
@@ -2,13 +2,19 @@
 #define __CORE_SHELL_DIFFUSION__
 
 #include <ostream>
+#include <istream>
 
 #include "math/Data-Type.hpp"
 
 #include "thermo-physical-properties/Core-Shell-Particle.hpp"
 #include "lusolver/LU-Solver.hpp"
 
-class CoreShellDiffusion : public CoreShellParticle
+#include "utilities/Frame-File.hpp"
+#include "utilities/Cache-Aligned-Array.hpp"
+
+// Particles begin a cache line and fill whole lines, so that particles
+// of neighbouring grid points updated by different threads share no line
+class alignas(CACHE_LINE_SIZE) CoreShellDiffusion : public CoreShellParticle
 {
     private :
 
@@ -18,12 +24,14 @@ class CoreShellDiffusion : public CoreShellParticle
 		LUSolver _solver_A;
 		LUSolver _solver_B;
 
-		static real_t *radial_coordinate_sqr;
-		static real_t *radial_coordinate_sqr_ratio;
+		const real_t * const radial_coordinate_sqr;
+		const real_t * const radial_coordinate_sqr_ratio;
 
-		static real_t getRadialCoordinate(size_t index);
+		real_t getRadialCoordinate(size_t index) const;
 
 		void updateMassFractions();
+
+		void setUpSpeciesEquations(LUSolver &solver, const real_t *concentration, real_t diffusivity);
 		
 		real_t getRxnConcA  (size_t index) const;
 		real_t getRxnConcB  (size_t index) const;
@@ -31,16 +39,13 @@ class CoreShellDiffusion : public CoreShellParticle
 
     public :
 
-		static const real_t delta_t;
+		const real_t delta_t;
 		
-		static const size_t n;
-		static const real_t delta_r;
+		const size_t n;
+		const real_t delta_r;
 
-		CoreShellDiffusion();
+		CoreShellDiffusion(const SimulationConfig &config);
 		~CoreShellDiffusion();
-
-		static void setUpRadiusArray();
-		static void deallocateRadiusArray();
 		
 		void initializeParticle();
 		
@@ -49,16 +54,40 @@ class CoreShellDiffusion : public CoreShellParticle
 		void setUpEquations(real_t temperature, CoreShellDiffusion &diffusion_problem);
 		void solveEquations();
 
+		// Same as setUpEquations followed by solveEquations, with species B
+		// set up and solved as an OpenMP task while the calling thread does species A.
+		// Idle threads of the team, such as those waiting at the end of a
+		// parallel loop, thus share the work of a single particle.
+		inline
+		void evolveSpeciesConcurrently(real_t temperature) { evolveSpeciesConcurrently(temperature, *this); }
+		void evolveSpeciesConcurrently(real_t temperature, CoreShellDiffusion &diffusion_problem);
+
 		real_t getAtomMassA() const;
 		real_t getAtomMassB() const;
 
 		void copyFrom(CoreShellDiffusion & diffusion_problem);
 		void copyTo(CoreShellDiffusion & diffusion_problem);
 
+		// Write and read the concentration profiles and the mass fractions
+		// in binary, restoring exactly the state that was written
+		void writeState(std::ostream &output_stream) const;
+		void readState(std::istream &input_stream);
+
 		void printConcentrationProfileA(std::ostream &output_stream, char delimiter = '\t', real_t curr_time = 0) const;
 		void printConcentrationProfileB(std::ostream &output_stream, char delimiter = '\t', real_t curr_time = 0) const;
 
-		static void printGridPoints(std::ostream &output_stream, char delimiter = '\t');
+		void printGridPoints(std::ostream &output_stream, char delimiter = '\t') const;
+
+		// Copies the n radial coordinates in m of the grid points to grid_points
+		void getGridPoints(real_t *grid_points) const;
+
+		// Append the concentration profiles at curr_time in s as frames
+		void writeConcentrationFrameA(FrameWriter &frame_writer, real_t curr_time = 0) const;
+		void writeConcentrationFrameB(FrameWriter &frame_writer, real_t curr_time = 0) const;
+
+		// Copy the n concentrations in mol/m3 at the grid points to concentration
+		void copyConcentrationProfileA(real_t *concentration) const;
+		void copyConcentrationProfileB(real_t *concentration) const;
 };
 
 #endif
\ No newline at end of file
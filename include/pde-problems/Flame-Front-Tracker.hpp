@@ -0,0 +1,156 @@
+#ifndef __FLAME_FRONT_TRACKER__
+#define __FLAME_FRONT_TRACKER__
+
+#include <istream>
+#include <ostream>
+#include <cstdint>
+#include <deque>
+#include <utility>
+
+#include "math/Data-Type.hpp"
+#include "math/Linear-Regression.hpp"
+
+#include "pde-problems/Pellet-Flame-Propagation.hpp"
+
+// Follows the flame front of a pellet during the simulation and estimates
+// the flame speed by a running least squares fit of front position against time.
+// Only positions away from the ignition zone and the far end of the pellet are fit.
+class FlameFrontTracker
+{
+	private:
+
+		real_t _time;
+		real_t _position;
+
+		LinearRegression _regression;
+
+		// Fit positions within the last window s, as pairs of time and position
+		std::deque<std::pair<real_t, real_t> > _window_points;
+
+	public:
+
+		// Temperature in K marking the flame front
+		const real_t flame_temperature;
+
+		// Positions in m of the flame front within which the speed is fit
+		const real_t lower_bound;
+		const real_t upper_bound;
+
+		// Duration in s over which the local flame speed is fit, 0 to not fit it
+		const real_t window;
+
+		FlameFrontTracker(
+			real_t lower_bound,
+			real_t upper_bound,
+			real_t flame_temperature = 1000.,
+			real_t window = 0
+		) :	_time(0),
+			_position(0),
+			flame_temperature(flame_temperature),
+			lower_bound(lower_bound),
+			upper_bound(upper_bound),
+			window(window)
+		{ ; }
+
+		// Records the flame front position of pellet at its current time
+		inline void track(const PelletFlamePropagation &pellet)
+		{
+			_time		= pellet.getTime();
+			_position	= pellet.getFlameFrontPosition(flame_temperature);
+
+			if (_position >= lower_bound && _position <= upper_bound)
+			{
+				_regression.addPoint(_time, _position);
+
+				if (window > 0) _window_points.push_back(std::make_pair(_time, _position));
+			}
+
+			while (!_window_points.empty() && _window_points.front().first < _time - window) _window_points.pop_front();
+		}
+
+		// Time in s of the last recorded position
+		inline real_t getTime() const { return _time; }
+
+		// Last recorded flame front position in m
+		inline real_t getPosition() const { return _position; }
+
+		// Number of positions fit
+		inline size_t getNumberOfPoints() const { return _regression.getNumberOfPoints(); }
+
+		// Returns flame speed in m/s, NAN until two positions are fit
+		inline real_t getFlameSpeed() const { return _regression.getSlope(); }
+
+		// Returns least squares standard error in m/s of the flame speed, NAN until three
+		// positions are fit. It is not a confidence interval - the positions of consecutive
+		// iterations are strongly correlated, and deviate from a line while the flame
+		// accelerates, so it understates the uncertainty of the speed by an order of magnitude
+		// or more. It only measures the scatter about the fit, use the steady flame check
+		// to decide whether the speed has converged.
+		inline real_t getFlameSpeedStandardError() const { return _regression.getSlopeStandardError(); }
+
+		// Returns flame speed in m/s fit to the positions of the last window s,
+		// NAN if fewer than two positions were fit in that time
+		inline real_t getLocalFlameSpeed() const
+		{
+			LinearRegression regression;
+
+			for (size_t i = 0; i < _window_points.size(); i++) regression.addPoint(_window_points[i].first, _window_points[i].second);
+
+			return regression.getSlope();
+		}
+
+		// Writes the fit in binary, so that a restarted run continues it with readState
+		inline void writeState(std::ostream &output_stream) const
+		{
+			output_stream.write((const char *) &_time,		sizeof(real_t));
+			output_stream.write((const char *) &_position,	sizeof(real_t));
+
+			_regression.writeState(output_stream);
+
+			const std::uint64_t number_of_window_points = _window_points.size();
+			output_stream.write((const char *) &number_of_window_points, sizeof(number_of_window_points));
+
+			for (size_t i = 0; i < _window_points.size(); i++)
+			{
+				output_stream.write((const char *) &_window_points[i].first,	sizeof(real_t));
+				output_stream.write((const char *) &_window_points[i].second,	sizeof(real_t));
+			}
+		}
+
+		inline void readState(std::istream &input_stream)
+		{
+			input_stream.read((char *) &_time,		sizeof(real_t));
+			input_stream.read((char *) &_position,	sizeof(real_t));
+
+			_regression.readState(input_stream);
+
+			std::uint64_t number_of_window_points = 0;
+			input_stream.read((char *) &number_of_window_points, sizeof(number_of_window_points));
+
+			_window_points.clear();
+
+			for (std::uint64_t i = 0; i < number_of_window_points && input_stream.good(); i++)
+			{
+				std::pair<real_t, real_t> point;
+
+				input_stream.read((char *) &point.first,	sizeof(real_t));
+				input_stream.read((char *) &point.second,	sizeof(real_t));
+
+				_window_points.push_back(point);
+			}
+		}
+
+		inline void printHeader(std::ostream &output_stream, char delimiter = ',') const
+		{
+			output_stream << "Time (s)" << delimiter << "Flame Front Position (m)" << delimiter;
+			output_stream << "Flame Speed (m/s)" << delimiter << "Flame Speed Fit Standard Error (m/s)\n";
+		}
+
+		inline void printState(std::ostream &output_stream, char delimiter = ',') const
+		{
+			output_stream << _time << delimiter << _position << delimiter;
+			output_stream << getFlameSpeed() << delimiter << getFlameSpeedStandardError() << '\n';
+		}
+};
+
+#endif
\ No newline at end of file
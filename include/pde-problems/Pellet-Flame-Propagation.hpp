@@ -1,15 +1,152 @@
 #ifndef __PELLET_FLAME_PROPAGATION__
 #define __PELLET_FLAME_PROPAGATION__
 
+#include <istream>
 #include <ostream>
+#include <cstdint>
+#include <vector>
 
 #include "math/Data-Type.hpp"
 #include "math/Linear-Expression.hpp"
 
+#include "thermo-physical-properties/Property-Bundle.hpp"
+
 #include "thermo-physical-properties/Packed-Pellet.hpp"
 #include "pde-problems/Core-Shell-Diffusion.hpp"
 #include "lusolver/LU-Solver.hpp"
 
+#include "utilities/Frame-File.hpp"
+#include "utilities/Node-Cost-Map.hpp"
+#include "utilities/Cache-Aligned-Array.hpp"
+
+#define PELLET_CHECKPOINT_VERSION 2
+
+// Grid points in a block of the task graph of setUpAndSolveEquationsAsTasks
+#define PELLET_TASK_BLOCK_NODES 16
+
+// Fewest grid points of a particle for which its species are solved
+// concurrently when few grid points are reacting, by default
+#define DEFAULT_SPECIES_TASKS_THRESHOLD 10000
+
+// Layout of a checkpoint file -
+// Header
+// Temperature, thermal conductivity and enthalpy of particles before their last update, m values each
+// State of each of the m particles, concentrations of A and B at n points followed by the mass fractions
+// State of the run outside the pellet, run_state_size bytes
+// Values are stored as real_t in the byte order of the machine that wrote them
+struct PelletCheckpointHeader
+{
+	char magic[8];
+
+	std::uint32_t version;
+	std::uint32_t value_size;
+
+	std::uint64_t m;
+	std::uint64_t n;
+
+	std::uint64_t config_hash;
+	std::uint64_t iteration;
+
+	std::uint64_t run_state_size;
+
+	real_t particle_volume_fractions;
+	real_t time;
+};
+
+// Copy of the state of a pellet at an instant, to be
+// written out while the simulation continues
+struct PelletSnapshot
+{
+	real_t time;
+
+	std::vector<real_t> x_grid_points;
+	std::vector<real_t> temperature;
+
+	// Extent in m of the grid points with reacting particles,
+	// NAN if no particle is reacting
+	real_t reaction_zone_begin;
+	real_t reaction_zone_end;
+
+	real_t flame_front_position;
+
+	// Grid point indices of the particles at the beginning,
+	// middle and end of the reaction zone
+	std::vector<size_t> particle_indices;
+
+	std::vector<real_t> r_grid_points;
+
+	// Concentration profiles of the selected particles, n values each
+	std::vector<real_t> concentration_A;
+	std::vector<real_t> concentration_B;
+};
+
+// Bytes allocated by a pellet, by what they hold
+struct PelletMemoryFootprint
+{
+	// Temperature and PelletNodeValues of each grid point
+	size_t temperatures;
+
+	// Properties of the gas and species at each grid point
+	size_t property_bundles;
+
+	// CoreShellDiffusion objects of the 3 particle arrays, m each
+	size_t particles;
+
+	// Concentrations of A and B at n points of every particle
+	size_t particle_profiles;
+
+	// Tridiagonal matrices and right hand sides of the 2 solvers of every particle
+	size_t particle_solver_workspaces;
+
+	// Tridiagonal matrix and right hand side of the solver of the pellet
+	size_t pellet_solver_workspace;
+
+	inline size_t getTotal() const
+	{
+		return
+			temperatures +
+			property_bundles +
+			particles +
+			particle_profiles +
+			particle_solver_workspaces +
+			pellet_solver_workspace;
+	}
+
+	// Writes bytes of each part and in total
+	void print(std::ostream &output_stream) const;
+};
+
+// Values of a grid point written by the thread it is handed to in the parallel loops.
+// The loops hand neighbouring grid points to different threads, one at a time, so
+// that the few reacting grid points are spread across all threads. Each grid point
+// thus has cache lines of its own, rather than an element of an array per value.
+struct alignas(CACHE_LINE_SIZE) PelletNodeValues
+{
+	real_t thermal_conductivity;
+
+	// Enthalpy of the particle before its last update
+	real_t prev_enthalpy_particle;
+
+	// Coefficients of the equation e * T[i+1] + f * T[i] + g * T[i-1] = b
+	// of the grid point, copied to the solver once set up
+	real_t e, f, g, b;
+};
+
+// Reads and validates the header of a checkpoint file
+PelletCheckpointHeader readPelletCheckpointHeader(const char *file_name);
+
+// State of the run kept outside the pellet, such as the flame speed fit,
+// saved with the pellet in checkpoints so that a restarted run continues it
+class RunState
+{
+	public:
+
+		virtual ~RunState() { ; }
+
+		virtual void writeState(std::ostream &output_stream) const = 0;
+		virtual void readState(std::istream &input_stream) = 0;
+};
+
 class PelletFlamePropagation : public PackedPellet
 {
 	private:
@@ -18,9 +155,15 @@ class PelletFlamePropagation : public PackedPellet
 		
 		real_t * _temperature_array;
 
-		real_t * _thermal_conductivity;
+		PelletNodeValues * _node_values;
 
-		real_t * _prev_enthalpy_particle;
+		// Properties of the interstitial gas and of the core, shell and
+		// product species at the current temperature of each grid point,
+		// shared by all particles at that grid point. A bundle fills a cache line.
+		PropertyBundle * _interstitial_gas_properties;
+		PropertyBundle * _core_species_properties;
+		PropertyBundle * _shell_species_properties;
+		PropertyBundle * _product_species_properties;
 		
 		CoreShellDiffusion * _particles_array;
 
@@ -29,10 +172,34 @@ class PelletFlamePropagation : public PackedPellet
 
 		LUSolver _solver;
 
-		static real_t getXCoordinate(size_t index);
+		// Time spent on each grid point is accumulated here if not NULL
+		NodeCostMap * _node_cost_map;
+
+		const PelletMemoryFootprint _memory_footprint;
+
+		// Particles of at least this many grid points may solve their species concurrently, 0 never
+		size_t _species_tasks_threshold;
+
+		// True while particles of the current iteration solve their species concurrently
+		bool _species_tasks;
+
+		// Iterations in which particles solved their species concurrently
+		size_t _species_tasks_iterations;
+
+		void chooseParticleParallelism();
+
+		void evolveParticle(CoreShellDiffusion &particle, real_t temperature, CoreShellDiffusion &diffusion_problem);
+
+		static size_t _memory_budget;
+
+		real_t getXCoordinate(size_t index) const;
 
 		bool inReactionZone(size_t index);
 
+		void evaluateProperties(size_t index);
+		void evaluateProperties();
+		PropertyBundle getParticleProperties(const CoreShellParticle &particle, size_t index);
+
 		void evolveParticleForEnthalpyDerivative(size_t index);
 
 		LinearExpression calcTransientTerm(size_t index);
@@ -41,26 +208,46 @@ class PelletFlamePropagation : public PackedPellet
 		void setUpBoundaryConditionX0();
 		void setUpBoundaryConditionXN();
 
+		void setUpEquation(size_t index);
+
+		// Copies the equations of interior grid points in [begin, end) to the solver
+		void copyEquations(size_t begin, size_t end);
+
+		void updateParticle(size_t index);
 		void updateParticles();
 
+		void updateBoundaryThermalConductivities();
+
+		size_t getTaskBlockBegin(size_t block) const;
+		size_t getTaskBlockEnd(size_t block) const;
+
 		real_t getInterstitialGasTransientTermCoefficient(size_t index);
 
 	public:
 	
-		static const real_t kappa;
+		const real_t kappa;
 
-		static const real_t gamma;
+		const real_t gamma;
 	
-		static const size_t m;
-		static const real_t delta_x;
+		const size_t m;
+		const real_t delta_x;
 
-		static const real_t delta_t;
+		const real_t delta_t;
 
-		static const real_t delta_T;
+		const real_t delta_T;
 
-		PelletFlamePropagation(real_t particle_volume_fraction);
+		// Aborts before allocating the particles if the pellet would exceed the memory budget
+		PelletFlamePropagation(const SimulationConfig &config, real_t particle_volume_fraction);
 		~PelletFlamePropagation();
 
+		// Returns bytes allocated by a pellet of m grid points with particles of n grid points
+		static PelletMemoryFootprint getMemoryFootprint(size_t m, size_t n);
+
+		// Pellets constructed later are refused if they need more than bytes, 0 for no limit
+		static void setMemoryBudget(size_t bytes);
+
+		inline const PelletMemoryFootprint & getMemoryFootprint() const { return _memory_footprint; }
+
 		void initializePellet(
 			real_t initial_ignition_temperature = 1500.,
 			real_t initial_ignition_length_fraction = 0.1
@@ -69,12 +256,69 @@ class PelletFlamePropagation : public PackedPellet
 		void setUpEquations();
 		void solveEquations();
 
+		// Same as setUpEquations followed by solveEquations, run as a graph of OpenMP tasks
+		// over blocks of grid points instead of loops separated by barriers. Forward
+		// substitution of a block starts as soon as its equations and those of the blocks
+		// before it are set up, and the particles of a block are updated as soon as
+		// backward substitution reaches it, while the blocks before it are still solved.
+		void setUpAndSolveEquationsAsTasks();
+
 		bool isCombustionComplete();
 
+		// Returns number of interior grid points whose particles are not completely reacted
+		size_t getNumberOfReactingNodes();
+
+		// Particles with at least threshold grid points solve species A and B concurrently in
+		// iterations where too few grid points are reacting to give every thread a
+		// reacting grid point, 0 to always parallelize over grid points only
+		inline void setSpeciesTasksThreshold(size_t threshold) { _species_tasks_threshold = threshold; }
+
+		// Returns number of iterations in which particles solved their species concurrently
+		inline size_t getSpeciesTasksIterations() const { return _species_tasks_iterations; }
+
+		// Accumulates time spent on each grid point in node_cost_map, of m nodes,
+		// from the next iteration on, NULL to stop
+		inline void setNodeCostMap(NodeCostMap *node_cost_map) { _node_cost_map = node_cost_map; }
+
+		// Writes the state after iteration # iteration, and run_state if not NULL, to file_name. The
+		// previous file is replaced only after the new one is complete, so an interrupted write loses nothing.
+		void writeCheckpoint(const char *file_name, size_t iteration, const RunState *run_state = NULL) const;
+
+		// Restores the state written by a pellet with the same config and particle
+		// volume fractions, and run_state if not NULL. Continuing from it is identical
+		// to never having stopped. Returns the number of iterations completed before the checkpoint.
+		size_t readCheckpoint(const char *file_name, RunState *run_state = NULL);
+
+		// Copies the temperature profile, the extent of the reaction zone and the
+		// concentration profiles of particles across the reaction zone to snapshot.
+		// Particles are reacting while they hold more than 0.1 % product and are
+		// not completely reacted.
+		void takeSnapshot(PelletSnapshot &snapshot) const;
+
+		// Returns simulated time in s
+		inline real_t getTime() const { return _time; }
+
+		// Returns x coordinate in m of the flame front, the farthest point from x = 0
+		// where temperature crosses flame_temperature in K, linearly interpolated
+		// between grid points. Returns 0 if no grid point is at or above flame_temperature.
+		real_t getFlameFrontPosition(real_t flame_temperature = 1000.) const;
+
+		// Returns highest temperature in K across the grid points
+		real_t getMaxTemperature() const;
+
 		void printTemperatureProfile(std::ostream &output_stream, char delimiter = '\t');
 		
 		void printGridPoints(std::ostream &output_stream, char delimiter = '\t');
 
+		// Copies the m x coordinates in m of the grid points to grid_points
+		void getGridPoints(real_t *grid_points) const;
+
+		// Appends the temperature profile at the current time as a frame
+		void writeTemperatureFrame(FrameWriter &frame_writer) const;
+
+		// Copies the m temperatures in K at the grid points to temperature
+		void copyTemperatureProfile(real_t *temperature) const;
+
 		void printDiffusionParticleGridPoints(std::ostream &output_stream, unsigned int particle_index, char delimiter = '\t');
 
 		void printDiffusionParticleConcentationProfiles(
@@ -0,0 +1,123 @@
+#ifndef __STEADY_FLAME_DETECTOR__
+#define __STEADY_FLAME_DETECTOR__
+
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <deque>
+#include <utility>
+
+#include "math/Data-Type.hpp"
+
+// Decides when the flame has reached a steady speed, from local flame speeds
+// fed at regular intervals. The flame is steady once the relative change of the
+// local speed over window s has stayed below tolerance for duration s.
+class SteadyFlameDetector
+{
+	private:
+
+		// Local speeds within the last window s, as pairs of time and speed
+		std::deque<std::pair<real_t, real_t> > _speeds;
+
+		// Time in s since when the change has stayed below tolerance, NAN if it has not
+		real_t _steady_since;
+
+		real_t _relative_change;
+
+	public:
+
+		const real_t tolerance;
+		const real_t window;
+		const real_t duration;
+
+		SteadyFlameDetector(
+			real_t tolerance,
+			real_t window,
+			real_t duration
+		) :	_steady_since(NAN),
+			_relative_change(NAN),
+			tolerance(tolerance),
+			window(window),
+			duration(duration)
+		{ ; }
+
+		// Records local flame speed in m/s at time in s,
+		// returns true once the flame is steady
+		inline bool update(real_t time, real_t speed)
+		{
+			if (std::isnan(speed))
+			{
+				_speeds.clear();
+				_steady_since = NAN;
+
+				return false;
+			}
+
+			_speeds.push_back(std::make_pair(time, speed));
+
+			// Keep the latest speed at least window s old as the reference
+			while (_speeds.size() > 1 && _speeds[1].first <= time - window) _speeds.pop_front();
+
+			if (_speeds.front().first > time - window)
+			{
+				_relative_change = NAN;
+
+				return false;
+			}
+
+			_relative_change = std::fabs(speed - _speeds.front().second) / std::fabs(speed);
+
+			if (_relative_change >= tolerance) _steady_since = NAN;
+
+			else if (std::isnan(_steady_since)) _steady_since = time;
+
+			return !std::isnan(_steady_since) && time - _steady_since >= duration;
+		}
+
+		// Writes the recorded speeds in binary, so that a restarted run continues with readState
+		inline void writeState(std::ostream &output_stream) const
+		{
+			output_stream.write((const char *) &_steady_since,		sizeof(real_t));
+			output_stream.write((const char *) &_relative_change,	sizeof(real_t));
+
+			const std::uint64_t number_of_speeds = _speeds.size();
+			output_stream.write((const char *) &number_of_speeds, sizeof(number_of_speeds));
+
+			for (size_t i = 0; i < _speeds.size(); i++)
+			{
+				output_stream.write((const char *) &_speeds[i].first,	sizeof(real_t));
+				output_stream.write((const char *) &_speeds[i].second,	sizeof(real_t));
+			}
+		}
+
+		inline void readState(std::istream &input_stream)
+		{
+			input_stream.read((char *) &_steady_since,		sizeof(real_t));
+			input_stream.read((char *) &_relative_change,	sizeof(real_t));
+
+			std::uint64_t number_of_speeds = 0;
+			input_stream.read((char *) &number_of_speeds, sizeof(number_of_speeds));
+
+			_speeds.clear();
+
+			for (std::uint64_t i = 0; i < number_of_speeds && input_stream.good(); i++)
+			{
+				std::pair<real_t, real_t> speed;
+
+				input_stream.read((char *) &speed.first,	sizeof(real_t));
+				input_stream.read((char *) &speed.second,	sizeof(real_t));
+
+				_speeds.push_back(speed);
+			}
+		}
+
+		// Returns relative change of the local speed over the last window s,
+		// NAN until speeds spanning window s are recorded
+		inline real_t getRelativeChange() const { return _relative_change; }
+
+		// Returns the last recorded local speed in m/s
+		inline real_t getSpeed() const { return _speeds.empty() ? NAN : _speeds.back().second; }
+};
+
+#endif
\ No newline at end of file
@@ -46,6 +46,12 @@ class ArrheniusDiffusivityModel
 
 				return _pre_exponential_factor_low * std::exp(- _activation_energy_low / temperature);
 		}
+
+		// Returns temperature in K above which the high temperature parameters apply
+		inline real_t getCriticalTemperature() const
+		{
+			return _critical_temperature;
+		}
 };
 
 #endif
\ No newline at end of file
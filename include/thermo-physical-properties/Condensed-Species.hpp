@@ -3,6 +3,7 @@
 
 #include <cstdlib>	// malloc & free
 #include <cstring>	// memcpy
+#include <memory>	// uninitialized_copy
 
 #include "math/Data-Type.hpp"
 #include "thermo-physical-properties/Phase.hpp"
@@ -32,6 +33,16 @@ class CondensedSpecies
 			std::memcpy(_phases, array_of_phases, number_of_phases * sizeof(Phase));
 		}
 
+		CondensedSpecies(
+			const CondensedSpecies &condensed_species
+		) : num_phases(condensed_species.num_phases),
+			molar_mass(condensed_species.molar_mass),
+			_molar_mass_inverse(condensed_species._molar_mass_inverse)
+		{
+			_phases = (Phase*) std::malloc(num_phases * sizeof(Phase));
+			std::uninitialized_copy(condensed_species._phases, condensed_species._phases + num_phases, _phases);
+		}
+
 		~CondensedSpecies()
 		{
 			std::free(_phases);
@@ -107,6 +118,32 @@ class CondensedSpecies
 
 			return heat_conductivity;
 		}
+
+		// Input temperature T in K
+		// Returns density (kg/m^3), specific enthalpy (J/kg),
+		// specific heat capacity (J/kg-K) and thermal conductivity (W/m-K)
+		// at temperature T and standard pressure, evaluating each phase only once
+		inline PropertyBundle evaluateAll(real_t temperature) const
+		{
+			PropertyBundle properties = {0, 0, 0, 0};
+
+			#pragma unroll
+
+				for (unsigned int i = 0; i < num_phases; i++)
+				{
+					PropertyBundle phase_properties = _phases[i].evaluateAll(temperature);
+
+					properties.density				+= phase_properties.density;
+					properties.enthalpy				+= phase_properties.enthalpy;
+					properties.heat_capacity		+= phase_properties.heat_capacity;
+					properties.thermal_conductivity	+= phase_properties.thermal_conductivity;
+				}
+
+			properties.enthalpy			*= _molar_mass_inverse;
+			properties.heat_capacity	*= _molar_mass_inverse;
+
+			return properties;
+		}
 };
 
 #endif
\ No newline at end of file
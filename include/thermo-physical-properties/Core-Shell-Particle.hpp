@@ -5,6 +5,8 @@
 #include "thermo-physical-properties/Condensed-Species.hpp"
 #include "thermo-physical-properties/Arrhenius-Diffusivity-Model.hpp"
 
+#include "utilities/Simulation-Config.hpp"
+
 class CoreShellParticle
 {
 	protected :
@@ -15,26 +17,18 @@ class CoreShellParticle
 
 	public :
 
-		static CondensedSpecies core_species;
-		static CondensedSpecies shell_species;
-		static CondensedSpecies product_species;
-
-		static ArrheniusDiffusivityModel diffusivity_model;
-
-		static const real_t overall_radius;
-		static const real_t core_radius;
+		// Species, dimensions and diffusivity model shared by all particles
+		const SimulationConfig &config;
 
-		static const real_t mass;
-
-		CoreShellParticle();
+		CoreShellParticle(const SimulationConfig &config);
 
 		// Input temperature T in K
 		// Returns density at temperature T and standard pressure in kg/m^3
 		inline real_t getDensity(real_t temperature) const
 		{
-			real_t volume_core_material		= _mass_fraction_core_material	  / core_species.getDensity(temperature);
-			real_t volume_shell_material	= _mass_fraction_shell_material	  / shell_species.getDensity(temperature);
-			real_t volume_product_material	= _mass_fraction_product_material / product_species.getDensity(temperature);
+			real_t volume_core_material		= _mass_fraction_core_material	  / config.core_species.getDensity(temperature);
+			real_t volume_shell_material	= _mass_fraction_shell_material	  / config.shell_species.getDensity(temperature);
+			real_t volume_product_material	= _mass_fraction_product_material / config.product_species.getDensity(temperature);
 
 			return 1. / (
 				volume_core_material +
@@ -48,9 +42,9 @@ class CoreShellParticle
 		inline real_t getEnthalpy(real_t temperature) const
 		{
 			return
-				_mass_fraction_core_material	* core_species.getEnthalpy(temperature) +
-				_mass_fraction_shell_material	* shell_species.getEnthalpy(temperature) +
-				_mass_fraction_product_material	* product_species.getEnthalpy(temperature);
+				_mass_fraction_core_material	* config.core_species.getEnthalpy(temperature) +
+				_mass_fraction_shell_material	* config.shell_species.getEnthalpy(temperature) +
+				_mass_fraction_product_material	* config.product_species.getEnthalpy(temperature);
 		}
 
 		// Input temperature T in K
@@ -58,18 +52,18 @@ class CoreShellParticle
 		inline real_t getHeatCapacity(real_t temperature) const
 		{
 			return 
-				_mass_fraction_core_material	* core_species.getHeatCapacity(temperature) +
-				_mass_fraction_shell_material	* shell_species.getHeatCapacity(temperature) +
-				_mass_fraction_product_material	* product_species.getHeatCapacity(temperature); 
+				_mass_fraction_core_material	* config.core_species.getHeatCapacity(temperature) +
+				_mass_fraction_shell_material	* config.shell_species.getHeatCapacity(temperature) +
+				_mass_fraction_product_material	* config.product_species.getHeatCapacity(temperature); 
 		}
 
 		// Input temperature T in K
 		// Returns thermal conductivity at temperature T and standard pressure in W/m-K
 		inline real_t getThermalConductivity(real_t temperature) const
 		{
-			real_t volume_fraction_core_material	= _mass_fraction_core_material	  / core_species.getDensity(temperature);
-			real_t volume_fraction_shell_material	= _mass_fraction_shell_material	  / shell_species.getDensity(temperature);
-			real_t volume_fraction_product_material	= _mass_fraction_product_material / product_species.getDensity(temperature);
+			real_t volume_fraction_core_material	= _mass_fraction_core_material	  / config.core_species.getDensity(temperature);
+			real_t volume_fraction_shell_material	= _mass_fraction_shell_material	  / config.shell_species.getDensity(temperature);
+			real_t volume_fraction_product_material	= _mass_fraction_product_material / config.product_species.getDensity(temperature);
 
 			real_t sum = volume_fraction_core_material + volume_fraction_shell_material + volume_fraction_product_material;
 
@@ -78,9 +72,58 @@ class CoreShellParticle
 			volume_fraction_product_material /= sum;
 
 			return
-				volume_fraction_core_material	 * core_species.getThermalConductivity(temperature)     +
-				volume_fraction_shell_material	 * shell_species.getThermalConductivity(temperature)    +
-				volume_fraction_product_material * product_species.getThermalConductivity(temperature)  ;
+				volume_fraction_core_material	 * config.core_species.getThermalConductivity(temperature)     +
+				volume_fraction_shell_material	 * config.shell_species.getThermalConductivity(temperature)    +
+				volume_fraction_product_material * config.product_species.getThermalConductivity(temperature)  ;
+		}
+
+		// Input properties of the core, shell and product species evaluated at the same temperature
+		// Returns density (kg/m^3), specific enthalpy (J/kg), specific heat capacity (J/kg-K)
+		// and thermal conductivity (W/m-K) of the particle at that temperature
+		inline PropertyBundle evaluateAll(
+			const PropertyBundle &core_species_properties,
+			const PropertyBundle &shell_species_properties,
+			const PropertyBundle &product_species_properties
+		) const
+		{
+			real_t volume_core_material		= _mass_fraction_core_material	  / core_species_properties.density;
+			real_t volume_shell_material	= _mass_fraction_shell_material	  / shell_species_properties.density;
+			real_t volume_product_material	= _mass_fraction_product_material / product_species_properties.density;
+
+			real_t sum = volume_core_material + volume_shell_material + volume_product_material;
+
+			PropertyBundle properties;
+
+			properties.density = 1. / sum;
+
+			properties.enthalpy =
+				_mass_fraction_core_material	* core_species_properties.enthalpy +
+				_mass_fraction_shell_material	* shell_species_properties.enthalpy +
+				_mass_fraction_product_material	* product_species_properties.enthalpy;
+
+			properties.heat_capacity =
+				_mass_fraction_core_material	* core_species_properties.heat_capacity +
+				_mass_fraction_shell_material	* shell_species_properties.heat_capacity +
+				_mass_fraction_product_material	* product_species_properties.heat_capacity;
+
+			properties.thermal_conductivity =
+				volume_core_material	/ sum * core_species_properties.thermal_conductivity	+
+				volume_shell_material	/ sum * shell_species_properties.thermal_conductivity	+
+				volume_product_material	/ sum * product_species_properties.thermal_conductivity	;
+
+			return properties;
+		}
+
+		// Input temperature T in K
+		// Returns density (kg/m^3), specific enthalpy (J/kg), specific heat capacity (J/kg-K)
+		// and thermal conductivity (W/m-K) at temperature T and standard pressure
+		inline PropertyBundle evaluateAll(real_t temperature) const
+		{
+			return evaluateAll(
+				config.core_species.evaluateAll(temperature),
+				config.shell_species.evaluateAll(temperature),
+				config.product_species.evaluateAll(temperature)
+			);
 		}
 
 		inline real_t getMassFractionsCoreMaterial() const
@@ -1,11 +1,16 @@
 #ifndef __IDEAL_GAS__
 #define __IDEAL_GAS__
 
+#include <cmath>
+#include <vector>
+
 #include "math/Data-Type.hpp"
 
 #include "math/Shomate-Expression.hpp"
 #include "math/Quadratic-Expression.hpp"
 
+#include "thermo-physical-properties/Property-Bundle.hpp"
+
 class IdealGas
 {
 	private :
@@ -15,6 +20,57 @@ class IdealGas
 
 		const real_t _molar_mass_inverse;
 
+		// Tabulated properties at uniformly spaced temperatures,
+		// density is not tabulated as it depends on pressure
+		std::vector<PropertyBundle> _property_table;
+
+		real_t _property_table_temperature_lower_bound;
+		real_t _property_table_temperature_step_inverse;
+
+		// Requires temperature in K
+		// Returns specific enthalpy (J/kg), specific heat capacity (J/kg-K)
+		// and thermal conductivity (W/m-K) from the Shomate and quadratic expressions
+		inline PropertyBundle evaluateExpressions(real_t temperature) const
+		{
+			real_t heat_capacity, enthalpy;
+			_enthalpy.evaluateExpressionAndIntegral(ShomateExpression::normalizeInput(temperature), heat_capacity, enthalpy);
+
+			PropertyBundle properties;
+
+			properties.density				= 0;
+			properties.enthalpy				= ShomateExpression::normalizeIntegralOutput(enthalpy) * _molar_mass_inverse;
+			properties.heat_capacity		= heat_capacity * _molar_mass_inverse;
+			properties.thermal_conductivity	= _thermal_conductivity.evaluateExpression(temperature);
+
+			return properties;
+		}
+
+		// Requires temperature in K
+		// Linearly interpolates the tabulated properties at temperature T
+		// Returns false if no table is set up or T lies outside the table
+		inline bool interpolatePropertyTable(real_t temperature, PropertyBundle &properties) const
+		{
+			real_t position = (temperature - _property_table_temperature_lower_bound) * _property_table_temperature_step_inverse;
+
+			// Also rejects NaN temperatures
+			if (!(position >= 0)) return false;
+
+			size_t j = position;
+
+			if (j + 1 >= _property_table.size()) return false;
+
+			real_t weight = position - (real_t) j;
+
+			const PropertyBundle &lower = _property_table[j];
+			const PropertyBundle &upper = _property_table[j+1];
+
+			properties.enthalpy				= lower.enthalpy + weight * (upper.enthalpy - lower.enthalpy);
+			properties.heat_capacity		= lower.heat_capacity + weight * (upper.heat_capacity - lower.heat_capacity);
+			properties.thermal_conductivity	= lower.thermal_conductivity + weight * (upper.thermal_conductivity - lower.thermal_conductivity);
+
+			return true;
+		}
+
 	public :
 
 		const real_t molar_mass;
@@ -30,7 +86,9 @@ class IdealGas
 			_thermal_conductivity(thermal_conductivity),
 			molar_mass(molar_mass),
 			gamma(gamma),
-			_molar_mass_inverse(1./molar_mass)
+			_molar_mass_inverse(1./molar_mass),
+			_property_table_temperature_lower_bound(0),
+			_property_table_temperature_step_inverse(0)
 		{
 			;
 		}
@@ -53,6 +111,10 @@ class IdealGas
 		// Returns specific enthalpy in J/kg
 		inline real_t getEnthalpy(real_t temperature) const
 		{
+			PropertyBundle properties;
+
+			if (interpolatePropertyTable(temperature, properties)) return properties.enthalpy;
+
 			return 
 			ShomateExpression::
 			normalizeIntegralOutput(
@@ -64,6 +126,10 @@ class IdealGas
 		// Returns specific heat capacity in J/kg-K
 		inline real_t getCp(real_t temperature) const
 		{
+			PropertyBundle properties;
+
+			if (interpolatePropertyTable(temperature, properties)) return properties.heat_capacity;
+
 			return _enthalpy.evaluateExpression(ShomateExpression::normalizeInput(temperature)) * _molar_mass_inverse;
 		}
 
@@ -71,8 +137,53 @@ class IdealGas
 		// Returns thermal conductivity in W/m-K
 		inline real_t getThermalConductivity(real_t temperature) const
 		{
+			PropertyBundle properties;
+
+			if (interpolatePropertyTable(temperature, properties)) return properties.thermal_conductivity;
+
 			return _thermal_conductivity.evaluateExpression(temperature);
 		}
+
+		// Requires temperature in K and pressure in Pa
+		// Returns density (kg/m^3), specific enthalpy (J/kg),
+		// specific heat capacity (J/kg-K) and thermal conductivity (W/m-K)
+		inline PropertyBundle evaluateAll(real_t temperature, real_t pressure = 1.01325E5) const
+		{
+			PropertyBundle properties;
+
+			if (!interpolatePropertyTable(temperature, properties)) properties = evaluateExpressions(temperature);
+
+			properties.density = getDensity(temperature, pressure);
+
+			return properties;
+		}
+
+		// Tabulates specific enthalpy, specific heat capacity and thermal conductivity
+		// at temperatures from lower bound to upper bound (in K) at intervals of step (in K).
+		// Temperatures within the table are then linearly interpolated
+		// instead of evaluating the Shomate and quadratic expressions
+		void setUpPropertyTable(
+			real_t temperature_lower_bound,
+			real_t temperature_upper_bound,
+			real_t temperature_step
+		) {
+			size_t table_size = std::ceil((temperature_upper_bound - temperature_lower_bound) / temperature_step) + 1;
+
+			_property_table.resize(table_size);
+
+			for (size_t j = 0; j < table_size; j++)
+			{
+				_property_table[j] = evaluateExpressions(temperature_lower_bound + (real_t) j * temperature_step);
+			}
+
+			_property_table_temperature_lower_bound		= temperature_lower_bound;
+			_property_table_temperature_step_inverse	= 1. / temperature_step;
+		}
+
+		inline bool hasPropertyTable() const
+		{
+			return !_property_table.empty();
+		}
 };
 
 #endif
\ No newline at end of file
@@ -7,27 +7,33 @@
 #include "thermo-physical-properties/Core-Shell-Particle.hpp"
 #include "thermo-physical-properties/Thermal-Conductivity-Pellet.hpp"
 
+#include "utilities/Simulation-Config.hpp"
+
 class PackedPellet
 {
 	public :
 
-		static const real_t length;
-		static const real_t diameter;
+		// Pellet dimensions, ambient conditions and particle data
+		const SimulationConfig &config;
+
+		const real_t length;
+		const real_t diameter;
 
-		static const real_t convective_heat_transfer_coefficient_curved_surface;
-		static const real_t convective_heat_transfer_coefficient_flat_surface;
-		static const real_t radiative_emissivity;
+		const real_t convective_heat_transfer_coefficient_curved_surface;
+		const real_t convective_heat_transfer_coefficient_flat_surface;
+		const real_t radiative_emissivity;
 		
-		static const real_t ambient_pressure;
-		static const real_t ambient_temperature;
+		const real_t ambient_pressure;
+		const real_t ambient_temperature;
 
-		static IdealGas interstitial_gas;
+		const IdealGas &interstitial_gas;
 
+		const real_t particle_volume_fractions;
 		const real_t interstitial_volume_fractions;
 		
 		const real_t overall_particle_density;
 
-		PackedPellet(real_t particle_volume_fractions);
+		PackedPellet(const SimulationConfig &config, real_t particle_volume_fractions);
 
 		// Input temperature T in K
 		// Returns thermal conductivity in W/m-K
@@ -39,6 +45,18 @@ class PackedPellet
 				ptr_2_particle->getThermalConductivity(temperature)
 			);
 		}
+
+		// Input thermal conductivities of interstitial gas and particle in W/m-K
+		// already evaluated at the same temperature
+		// Returns thermal conductivity in W/m-K
+		inline real_t getThermalConductivity(real_t gas_thermal_conductivity, real_t particle_thermal_conductivity) const
+		{
+			return getThermalConductivityMEB(
+				interstitial_volume_fractions,
+				gas_thermal_conductivity,
+				particle_thermal_conductivity
+			);
+		}
 };
 
 #endif
\ No newline at end of file
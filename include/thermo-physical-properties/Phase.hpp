@@ -7,6 +7,8 @@
 #include "math/Shomate-Expression.hpp"
 #include "math/Quadratic-Expression.hpp"
 
+#include "thermo-physical-properties/Property-Bundle.hpp"
+
 class Phase
 {
 	private:
@@ -21,19 +23,23 @@ class Phase
 
 	public:
 
-		static const real_t sharpness_coefficient;
+		// Scale of the sigmoid functions smoothing the transition
+		// across the temperature bounds, in 1/K
+		const real_t sharpness_coefficient;
 
 		Phase(
 			real_t density,
 			ShomateExpression	&enthalpy,
 			QuadraticExpression &thermal_conductivity,
+			real_t sharpness_coefficient,
 			real_t temperature_lower_bound = 0,
 			real_t temeprature_upper_bound = INFINITY
 		) : _enthalpy(enthalpy),
 			_thermal_conductivity(thermal_conductivity),
 			_density(density),
 			_temperature_lower_bound(temperature_lower_bound),
-			_temperature_upper_bound(temeprature_upper_bound)
+			_temperature_upper_bound(temeprature_upper_bound),
+			sharpness_coefficient(sharpness_coefficient)
 		{
 			;
 		}
@@ -88,6 +94,34 @@ class Phase
 				getSigmoid(temperature, _temperature_upper_bound, sharpness_coefficient)
 			);
 		}
+
+		// Input temperature T in K
+		// Returns density (kg/m^3), standard enthalpy (J/mol.),
+		// heat capacity (J/mol.-K) and thermal conductivity (W/m-K) at temperature T,
+		// evaluating the sigmoids and the Shomate expression only once
+		inline PropertyBundle evaluateAll(real_t temperature) const
+		{
+			real_t sigmoid_lower = getSigmoid(temperature, _temperature_lower_bound, sharpness_coefficient);
+			real_t sigmoid_upper = getSigmoid(temperature, _temperature_upper_bound, sharpness_coefficient);
+
+			real_t sigmoid_difference = sigmoid_lower - sigmoid_upper;
+			real_t sigmoid_derivative_difference =
+				sharpness_coefficient * sigmoid_lower * (1 - sigmoid_lower) -
+				sharpness_coefficient * sigmoid_upper * (1 - sigmoid_upper);
+
+			real_t heat_capacity, enthalpy;
+			_enthalpy.evaluateExpressionAndIntegral(ShomateExpression::normalizeInput(temperature), heat_capacity, enthalpy);
+			enthalpy = ShomateExpression::normalizeIntegralOutput(enthalpy);
+
+			PropertyBundle properties;
+
+			properties.density				= _density * sigmoid_difference;
+			properties.enthalpy				= enthalpy * sigmoid_difference;
+			properties.heat_capacity		= heat_capacity * sigmoid_difference + enthalpy * sigmoid_derivative_difference;
+			properties.thermal_conductivity	= _thermal_conductivity.evaluateExpression(temperature) * sigmoid_difference;
+
+			return properties;
+		}
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,17 @@
+#ifndef __PROPERTY_BUNDLE__
+#define __PROPERTY_BUNDLE__
+
+#include "math/Data-Type.hpp"
+
+// Thermo-physical properties evaluated together at a single temperature.
+// Units follow the object that filled the bundle, i.e.,
+// J/mol. and J/mol.-K for a Phase, J/kg and J/kg-K for species and particles
+struct PropertyBundle
+{
+	real_t density;
+	real_t enthalpy;
+	real_t heat_capacity;
+	real_t thermal_conductivity;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+/**
+ * @file Async-Profile-Writer.hpp
+ * @brief Writes profiles to a sink on a dedicated thread
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __ASYNC_PROFILE_WRITER__
+#define __ASYNC_PROFILE_WRITER__
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "math/Data-Type.hpp"
+#include "utilities/Profile-Sink.hpp"
+
+// Profiles are copied into a ring of preallocated buffers by the simulation
+// and formatted and written to the sink by a writer thread.
+// When every buffer is waiting to be written, acquiring a buffer blocks
+// until the writer thread frees one, so that memory use stays bounded.
+class AsyncProfileWriter
+{
+	private:
+
+		ProfileSink &_sink;
+
+		const size_t _number_of_points;
+		const size_t _number_of_buffers;
+
+		std::vector<real_t> _buffers;
+		std::vector<real_t> _times;
+
+		// Buffer handed out next and buffer written next by the writer thread
+		size_t _head;
+		size_t _tail;
+
+		// Number of submitted buffers not yet written
+		size_t _pending;
+
+		size_t _number_of_stalls;
+
+		bool _stop;
+
+		std::mutex _mutex;
+
+		std::condition_variable _buffer_submitted;
+		std::condition_variable _buffer_written;
+
+		std::thread _writer_thread;
+
+		void writeBuffers();
+
+	public:
+
+		AsyncProfileWriter(ProfileSink &sink, size_t number_of_points, size_t number_of_buffers = 4);
+
+		// Writes all submitted profiles and stops the writer thread
+		~AsyncProfileWriter();
+
+		// Returns a buffer of number_of_points values to copy a profile into,
+		// blocks while all buffers are waiting to be written
+		real_t * acquireBuffer();
+
+		// Queues the last acquired buffer as the profile at time in s
+		void submitBuffer(real_t time);
+
+		// Blocks until all submitted profiles are written and flushes the sink
+		void flush();
+
+		// Returns number of times acquireBuffer had to wait for the writer thread
+		size_t getNumberOfStalls();
+};
+
+#endif
\ No newline at end of file
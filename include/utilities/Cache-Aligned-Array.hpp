@@ -0,0 +1,54 @@
+/**
+ * @file Cache-Aligned-Array.hpp
+ * @brief Arrays whose blocks written by different threads do not share cache lines
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __CACHE_ALIGNED_ARRAY__
+#define __CACHE_ALIGNED_ARRAY__
+
+#include <cstddef>
+#include <new>
+
+// Bytes in a cache line of the processors the solver runs on
+#define CACHE_LINE_SIZE 64
+
+// Returns bytes before the storage of an array of T placing element # first at a cache line
+template <typename T>
+inline size_t getCacheAlignedArrayOffset(size_t first)
+{
+	return (CACHE_LINE_SIZE - (first * sizeof(T)) % CACHE_LINE_SIZE) % CACHE_LINE_SIZE;
+}
+
+// Returns bytes allocated by allocateCacheAlignedArray for size elements of T
+template <typename T>
+inline size_t getCacheAlignedArrayBytes(size_t size, size_t first = 0)
+{
+	return getCacheAlignedArrayOffset<T>(first) + size * sizeof(T);
+}
+
+// Allocates uninitialized storage for size elements of T with element # first
+// beginning a cache line. Threads then write blocks of elements starting at
+// first + k * block without sharing cache lines, when block elements fill whole lines.
+// Elements of types that are not trivial must be constructed with placement new.
+template <typename T>
+inline T * allocateCacheAlignedArray(size_t size, size_t first = 0)
+{
+	char * storage = static_cast<char *>(operator new[](getCacheAlignedArrayBytes<T>(size, first), std::align_val_t(CACHE_LINE_SIZE)));
+
+	return reinterpret_cast<T *>(storage + getCacheAlignedArrayOffset<T>(first));
+}
+
+// Frees storage of allocateCacheAlignedArray with the same first,
+// elements that are not trivial must be destroyed before
+template <typename T>
+inline void deallocateCacheAlignedArray(T * array, size_t first = 0)
+{
+	operator delete[](reinterpret_cast<char *>(array) - getCacheAlignedArrayOffset<T>(first), std::align_val_t(CACHE_LINE_SIZE));
+}
+
+#endif
\ No newline at end of file
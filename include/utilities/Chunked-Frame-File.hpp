@@ -0,0 +1,176 @@
+/**
+ * @file Chunked-Frame-File.hpp
+ * @brief Frames split over fixed size frame files with a time index for random access
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __CHUNKED_FRAME_FILE__
+#define __CHUNKED_FRAME_FILE__
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "math/Data-Type.hpp"
+#include "utilities/Profile-Sink.hpp"
+#include "utilities/Frame-File.hpp"
+
+#define CHUNK_INDEX_VERSION 1
+
+// Name of the index file and format of the names of the chunks in a chunked frame directory
+#define CHUNK_INDEX_FILE_NAME "index.bin"
+#define CHUNK_FILE_NAME_FORMAT "chunk-%05u.frames"
+
+// Layout of a chunked frame directory -
+// Chunks, frame files of frames_per_chunk frames each, except the last
+// Index file, the header followed by an entry per frame in order of time,
+// appended as frames are written, so that its size gives the number of frames
+struct ChunkIndexHeader
+{
+	char magic[8];
+
+	std::uint32_t version;
+	std::uint32_t reserved;
+
+	std::uint64_t number_of_points;
+	std::uint64_t frames_per_chunk;
+};
+
+struct ChunkIndexEntry
+{
+	double time;
+
+	std::uint32_t chunk;
+	std::uint32_t reserved;
+
+	// Offset in bytes of the frame in the chunk
+	std::uint64_t offset;
+};
+
+// Returns path of chunk # chunk in directory
+std::string getChunkFileName(const std::string &directory, size_t chunk);
+
+class ChunkedFrameWriter : public ProfileSink
+{
+	private:
+
+		const std::string _directory;
+
+		const size_t _number_of_points;
+		const std::vector<real_t> _grid_points;
+
+		const std::string _quantity;
+		const std::string _quantity_units;
+		const std::string _grid_units;
+
+		const FrameDataType _data_type;
+
+		std::ofstream _index_file;
+
+		std::ofstream _chunk_file;
+		FrameWriter * _chunk_writer;
+
+		size_t _number_of_chunks;
+		size_t _number_of_frames;
+
+		void closeChunk();
+
+	public:
+
+		const size_t frames_per_chunk;
+
+		// Creates directory and its index file, which hold frames
+		// of number_of_points values on the grid grid_points
+		ChunkedFrameWriter(
+			const std::string &directory,
+			size_t number_of_points,
+			const real_t *grid_points,
+			const char *quantity,
+			const char *quantity_units,
+			const char *grid_units,
+			size_t frames_per_chunk = 1000,
+			FrameDataType data_type = FRAME_FLOAT64
+		);
+
+		// Closes the last chunk and the index
+		~ChunkedFrameWriter();
+
+		// Appends a frame to the last chunk, starting a new chunk if it is full
+		void writeProfile(real_t time, const real_t *values, size_t number_of_points);
+
+		void flush();
+
+		inline size_t getNumberOfFrames() const { return _number_of_frames; }
+		inline size_t getNumberOfChunks() const { return _number_of_chunks; }
+};
+
+// Reads frames of a chunked frame directory through memory maps of
+// the index and the chunks, so that any frame is read without scanning.
+// Chunks are mapped when a frame in them is first read.
+class ChunkedFrameReader
+{
+	private:
+
+		struct MappedChunk
+		{
+			const char * memory;
+			size_t size;
+		};
+
+		const std::string _directory;
+
+		const char * _index_memory;
+		size_t _index_size;
+
+		const ChunkIndexHeader * _header;
+		const ChunkIndexEntry * _entries;
+
+		size_t _number_of_frames;
+
+		std::vector<MappedChunk> _chunks;
+
+		FrameFileHeader _chunk_header;
+
+		std::string _quantity;
+		std::string _quantity_units;
+		std::string _grid_units;
+
+		std::vector<real_t> _grid_points;
+
+		const MappedChunk & getChunk(size_t chunk);
+
+	public:
+
+		// Maps the index of directory and reads the grid from its first chunk
+		ChunkedFrameReader(const char *directory);
+		~ChunkedFrameReader();
+
+		inline size_t getNumberOfPoints() const { return _header->number_of_points; }
+		inline size_t getNumberOfFrames() const { return _number_of_frames; }
+
+		inline const std::string & getQuantity()		const { return _quantity; }
+		inline const std::string & getQuantityUnits()	const { return _quantity_units; }
+		inline const std::string & getGridUnits()		const { return _grid_units; }
+
+		inline const real_t * getGridPoints() const { return _grid_points.data(); }
+
+		inline real_t getTime(size_t frame_index) const { return _entries[frame_index].time; }
+
+		// Returns index of the first frame at or after time in s,
+		// the number of frames if there is none
+		size_t findFrame(real_t time) const;
+
+		// Reads time in s and number_of_points values of frame # frame_index
+		void readFrame(size_t frame_index, real_t &time, real_t *values);
+
+		// Reads all frames from begin_time to end_time in s, both inclusive, into times
+		// and values, number_of_points values per frame. Returns the number of frames read.
+		size_t readFrames(real_t begin_time, real_t end_time, std::vector<real_t> &times, std::vector<real_t> &values);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,188 @@
+/**
+ * @file Compressed-Frame-File.hpp
+ * @brief Losslessly compressed stream of time indexed frames of a profile on a fixed grid
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __COMPRESSED_FRAME_FILE__
+#define __COMPRESSED_FRAME_FILE__
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "math/Data-Type.hpp"
+#include "utilities/Profile-Sink.hpp"
+#include "utilities/Frame-File.hpp"
+
+#define COMPRESSED_FRAME_FILE_VERSION 1
+
+// Layout of a compressed frame file -
+// Header
+// Metadata - quantity name, quantity units and grid units, each as a 32 bit length and characters
+// Grid points, number_of_points values of data_type
+// Blocks of up to frames_per_block frames, each a block header followed by
+// compressed_size bytes of deflate compressed frames
+//
+// Frames of a block are encoded before compression so that smooth profiles
+// compress well without losing any bits -
+// each frame, the time followed by number_of_points values of data_type, is
+// XORed bitwise with the frame before it in the block, so that unchanged values
+// become zeros, then bytes of all values of the block are shuffled so that
+// byte # b of every value is stored together, grouping the slowly varying
+// sign and exponent bytes apart from the noisy low mantissa bytes.
+struct CompressedFrameFileHeader
+{
+	char magic[8];
+
+	std::uint32_t version;
+	std::uint32_t data_type;
+	std::uint32_t value_size;
+	std::uint32_t frames_per_block;
+
+	std::uint64_t number_of_points;
+	std::uint64_t reserved;
+};
+
+struct CompressedFrameBlockHeader
+{
+	std::uint32_t number_of_frames;
+	std::uint32_t reserved;
+
+	std::uint64_t compressed_size;
+
+	double begin_time;
+	double end_time;
+};
+
+// Frames are buffered until a block is full and the block is encoded and
+// compressed by the thread calling writeProfile, the writer thread when
+// used with AsyncProfileWriter. The last partial block is written when the
+// writer is destroyed, so a crashed run loses at most frames_per_block frames.
+class CompressedFrameWriter : public ProfileSink
+{
+	private:
+
+		std::ostream &_output_stream;
+
+		CompressedFrameFileHeader _header;
+
+		// Current frame and the frame before it in the block
+		std::vector<char> _frame;
+		std::vector<char> _previous_frame;
+
+		// Encoded frames of the current block
+		std::vector<char> _block;
+		std::vector<char> _shuffled_block;
+		std::vector<unsigned char> _compressed_block;
+
+		CompressedFrameBlockHeader _block_header;
+
+		std::uint64_t _number_of_frames;
+		std::uint64_t _uncompressed_size;
+		std::uint64_t _compressed_size;
+
+		void writeBlock();
+
+	public:
+
+		const int compression_level;
+
+		// Writes the header, metadata and grid points to output_stream,
+		// which must be opened in binary mode. compression_level is that of
+		// zlib, from 1 for fastest to 9 for smallest.
+		CompressedFrameWriter(
+			std::ostream &output_stream,
+			size_t number_of_points,
+			const real_t *grid_points,
+			const char *quantity,
+			const char *quantity_units,
+			const char *grid_units,
+			size_t frames_per_block = 64,
+			FrameDataType data_type = FRAME_FLOAT64,
+			int compression_level = 6
+		);
+
+		// Writes the last partial block
+		~CompressedFrameWriter();
+
+		// Appends a frame, number_of_points must match the grid of the file
+		void writeProfile(real_t time, const real_t *values, size_t number_of_points);
+
+		// Flushes the stream, frames of the partial block stay buffered
+		void flush();
+
+		inline size_t getNumberOfFrames() const { return _number_of_frames; }
+
+		// Sizes in bytes of the frames of the written blocks before and after compression
+		inline std::uint64_t getUncompressedSize()	const { return _uncompressed_size; }
+		inline std::uint64_t getCompressedSize()	const { return _compressed_size; }
+};
+
+// Reads frames of a compressed frame file. Block headers are scanned when
+// the file is opened, and a block is decompressed when a frame in it is read.
+// The last decompressed block is kept, so frames are best read in order.
+class CompressedFrameReader
+{
+	private:
+
+		struct Block
+		{
+			std::uint64_t offset;
+			std::uint64_t compressed_size;
+
+			size_t first_frame;
+			size_t number_of_frames;
+		};
+
+		std::ifstream _input_stream;
+
+		CompressedFrameFileHeader _header;
+
+		std::string _quantity;
+		std::string _quantity_units;
+		std::string _grid_units;
+
+		std::vector<real_t> _grid_points;
+
+		std::vector<Block> _blocks;
+
+		size_t _number_of_frames;
+
+		// Decoded frames of block # _decoded_block
+		size_t _decoded_block;
+		std::vector<char> _decoded_frames;
+
+		std::vector<unsigned char> _compressed_block;
+		std::vector<char> _shuffled_block;
+
+		void decodeBlock(size_t block);
+
+	public:
+
+		// Opens a compressed frame file and validates its header. A block
+		// truncated by a crash is ignored along with its frames.
+		CompressedFrameReader(const char *file_name);
+
+		inline size_t getNumberOfPoints() const { return _header.number_of_points; }
+		inline size_t getNumberOfFrames() const { return _number_of_frames; }
+
+		inline FrameDataType getDataType() const { return (FrameDataType) _header.data_type; }
+
+		inline const std::string & getQuantity()		const { return _quantity; }
+		inline const std::string & getQuantityUnits()	const { return _quantity_units; }
+		inline const std::string & getGridUnits()		const { return _grid_units; }
+
+		inline const real_t * getGridPoints() const { return _grid_points.data(); }
+
+		// Reads time in s and number_of_points values of frame # frame_index
+		void readFrame(size_t frame_index, real_t &time, real_t *values);
+};
+
+#endif
\ No newline at end of file
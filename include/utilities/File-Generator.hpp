@@ -29,6 +29,16 @@ class FileGenerator
 
         std::ofstream getTXTFile(std::string name);        
         std::ofstream getTXTFile(std::string name, std::string folder);        
+
+        // Binary files for FrameWriter
+        std::ofstream getFrameFile(std::string name);
+        std::ofstream getFrameFile(std::string name, std::string folder);
+
+        // Binary files for CompressedFrameWriter
+        std::ofstream getCompressedFrameFile(std::string name);
+
+        // Folder in which the files are created
+        inline const std::string & getFolderName() const { return _folder_name; }
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+/**
+ * @file Frame-File.hpp
+ * @brief Binary container of time indexed frames of a profile on a fixed grid
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __FRAME_FILE__
+#define __FRAME_FILE__
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "math/Data-Type.hpp"
+#include "utilities/Profile-Sink.hpp"
+
+#define FRAME_FILE_VERSION 1
+
+// Type in which the time and the values of each frame are stored
+enum FrameDataType
+{
+	FRAME_FLOAT32		= 1,
+	FRAME_FLOAT64		= 2,
+	FRAME_LONG_DOUBLE	= 3
+};
+
+// Layout of a frame file -
+// Header
+// Metadata - quantity name, quantity units and grid units, each as a 32 bit length and characters
+// Grid points, number_of_points values of data_type
+// Frames starting at frames_offset, each the time followed by number_of_points values of data_type
+// Index of number_of_frames entries starting at index_offset, written when the file is closed
+struct FrameFileHeader
+{
+	char magic[8];
+
+	std::uint32_t version;
+	std::uint32_t data_type;
+	std::uint32_t value_size;
+	std::uint32_t reserved;
+
+	std::uint64_t number_of_points;
+	std::uint64_t frame_size;
+	std::uint64_t frames_offset;
+
+	// Zero until the file is closed
+	std::uint64_t number_of_frames;
+	std::uint64_t index_offset;
+};
+
+struct FrameIndexEntry
+{
+	double time;
+	std::uint64_t offset;
+};
+
+// Returns size in bytes of a value of data_type
+size_t getFrameDataTypeSize(FrameDataType data_type);
+
+// Converts number_of_values real_t values to data_type and stores them in buffer
+void convertToFrameValues(FrameDataType data_type, size_t number_of_values, const real_t *values, char *buffer);
+
+// Converts number_of_values values of data_type stored in buffer to real_t
+void convertFrameValues(FrameDataType data_type, size_t number_of_values, const char *buffer, real_t *values);
+
+class FrameWriter : public ProfileSink
+{
+	private:
+
+		std::ostream &_output_stream;
+
+		FrameFileHeader _header;
+
+		std::vector<char> _buffer;
+		std::vector<FrameIndexEntry> _index;
+
+		std::streamoff _header_position;
+		std::streamoff _position;
+
+		bool _closed;
+
+		void convertValues(size_t number_of_values, const real_t *values, char *buffer) const;
+
+	public:
+
+		// Writes the header, metadata and grid points to output_stream,
+		// which must be opened in binary mode and be seekable
+		FrameWriter(
+			std::ostream &output_stream,
+			size_t number_of_points,
+			const real_t *grid_points,
+			const char *quantity,
+			const char *quantity_units,
+			const char *grid_units,
+			FrameDataType data_type = FRAME_FLOAT64
+		);
+
+		// Closes the file if not already closed
+		~FrameWriter();
+
+		// Appends a frame of number_of_points values at time in s
+		void writeFrame(real_t time, const real_t *values);
+
+		// Appends a frame, number_of_points must match the grid of the file
+		void writeProfile(real_t time, const real_t *values, size_t number_of_points);
+
+		void flush();
+
+		// Writes the frame index and the final header, no frames may be written after
+		void close();
+
+		inline size_t getNumberOfFrames() const { return _index.size(); }
+
+		// Offset in bytes of frame # frame_index from the start of the file
+		inline std::uint64_t getFrameOffset(size_t frame_index) const { return _index[frame_index].offset; }
+};
+
+class FrameReader
+{
+	private:
+
+		std::ifstream _input_stream;
+
+		FrameFileHeader _header;
+
+		std::string _quantity;
+		std::string _quantity_units;
+		std::string _grid_units;
+
+		std::vector<real_t> _grid_points;
+		std::vector<FrameIndexEntry> _index;
+
+		std::vector<char> _buffer;
+
+		void convertValues(size_t number_of_values, const char *buffer, real_t *values) const;
+
+	public:
+
+		// Opens a frame file and validates its header. Frames of a file that
+		// was not closed, for example by a crash, are recovered from its size.
+		FrameReader(const char *file_name);
+
+		inline size_t getNumberOfPoints() const { return _header.number_of_points; }
+		inline size_t getNumberOfFrames() const { return _index.size(); }
+
+		inline FrameDataType getDataType() const { return (FrameDataType) _header.data_type; }
+
+		inline const std::string & getQuantity()		const { return _quantity; }
+		inline const std::string & getQuantityUnits()	const { return _quantity_units; }
+		inline const std::string & getGridUnits()		const { return _grid_units; }
+
+		inline const real_t * getGridPoints() const { return _grid_points.data(); }
+
+		inline real_t getTime(size_t frame_index) const { return _index[frame_index].time; }
+
+		// Reads time in s and number_of_points values of frame # frame_index
+		void readFrame(size_t frame_index, real_t &time, real_t *values);
+};
+
+#endif
\ No newline at end of file
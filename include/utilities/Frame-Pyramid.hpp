@@ -0,0 +1,87 @@
+/**
+ * @file Frame-Pyramid.hpp
+ * @brief Decimated levels of a profile history for quick visualization
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __FRAME_PYRAMID__
+#define __FRAME_PYRAMID__
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "math/Data-Type.hpp"
+#include "utilities/Profile-Sink.hpp"
+#include "utilities/Frame-File.hpp"
+
+// Format of the names of the frame files of each level of a pyramid directory
+#define PYRAMID_MIN_FILE_NAME_FORMAT "level-%u-min.frames"
+#define PYRAMID_MAX_FILE_NAME_FORMAT "level-%u-max.frames"
+
+// Passes profiles on to a sink holding the full resolution history,
+// and writes decimated levels of the history alongside.
+// Level # k, k = 1, 2, ... covers blocks of 2^k grid points by 2^k frames.
+// Each block is reduced to its minimum and maximum, written to separate
+// frame files, so that steep fronts keep their extent at every level.
+// Block grid points are the midpoints of the blocks and block times
+// are the times of the first frames of the blocks.
+class PyramidProfileSink : public ProfileSink
+{
+	private:
+
+		struct Level
+		{
+			size_t factor;
+
+			std::ofstream min_file;
+			std::ofstream max_file;
+
+			FrameWriter * min_writer;
+			FrameWriter * max_writer;
+
+			// Extremes over the frames of the current block so far
+			std::vector<real_t> min_values;
+			std::vector<real_t> max_values;
+
+			size_t number_of_frames_in_block;
+			real_t block_time;
+		};
+
+		ProfileSink &_full_resolution_sink;
+
+		const size_t _number_of_points;
+
+		std::vector<Level *> _levels;
+
+		void writeBlock(Level &level);
+
+	public:
+
+		// Creates directory with number_of_levels levels of profiles
+		// of number_of_points values on the grid grid_points
+		PyramidProfileSink(
+			ProfileSink &full_resolution_sink,
+			const std::string &directory,
+			size_t number_of_levels,
+			size_t number_of_points,
+			const real_t *grid_points,
+			const char *quantity,
+			const char *quantity_units,
+			const char *grid_units,
+			FrameDataType data_type = FRAME_FLOAT64
+		);
+
+		// Writes the incomplete blocks at the end of the history and closes the levels
+		~PyramidProfileSink();
+
+		void writeProfile(real_t time, const real_t *values, size_t number_of_points);
+
+		void flush();
+};
+
+#endif
\ No newline at end of file
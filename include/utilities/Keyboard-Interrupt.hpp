@@ -25,4 +25,19 @@ class InterruptException : public std::exception
 
 void setUpKeyboardInterrupt();
 
+// Records SIGINT and SIGTERM instead of interrupting the program,
+// so that they can be handled where the state is consistent
+void setUpInterruptFlag();
+
+// Returns the last signal recorded, 0 if none
+int getInterruptSignal();
+
+// Records SIGUSR1 as a request for a snapshot of the simulation,
+// which continues running
+void setUpSnapshotRequest();
+
+// Returns true if SIGUSR1 was received since the last call. Signals received
+// between two calls yield a single request. Cheap enough to be polled every iteration.
+bool isSnapshotRequested();
+
 #endif
\ No newline at end of file
@@ -0,0 +1,24 @@
+/**
+ * @file Memory-Usage.hpp
+ * @brief Resident memory of the process as reported by Linux
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __MEMORY_USAGE__
+#define __MEMORY_USAGE__
+
+#include <cstddef>
+
+// Returns bytes of the process resident in memory now,
+// 0 if /proc/self/status cannot be read
+size_t getResidentSetSize();
+
+// Returns the largest bytes of the process resident in memory so far,
+// 0 if /proc/self/status cannot be read
+size_t getPeakResidentSetSize();
+
+#endif
\ No newline at end of file
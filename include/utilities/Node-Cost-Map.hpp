@@ -0,0 +1,111 @@
+/**
+ * @file Node-Cost-Map.hpp
+ * @brief Wall time spent on each grid point of the pellet
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __NODE_COST_MAP__
+#define __NODE_COST_MAP__
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>	// memset
+
+#include "math/Data-Type.hpp"
+
+#include "utilities/Cache-Aligned-Array.hpp"
+
+enum NodeCostKind
+{
+	// Transient term, including the particle evolutions for the enthalpy derivative
+	NODE_COST_TRANSIENT_TERM,
+
+	// Particle update after the pellet solve
+	NODE_COST_PARTICLE_UPDATE,
+
+	NUMBER_OF_NODE_COST_KINDS
+};
+
+// Times of a grid point, alone in its cache line so that
+// threads timing neighbouring grid points never share a line
+struct alignas(CACHE_LINE_SIZE) NodeCost
+{
+	std::uint64_t nanoseconds[NUMBER_OF_NODE_COST_KINDS];
+};
+
+// Accumulates the wall time spent on each grid point between resets.
+// Each grid point is worked on by one thread at a time in the parallel loops
+// of the solver, so grid points are accumulated without synchronization.
+class NodeCostMap
+{
+	private:
+
+		NodeCost * _costs;
+
+	public:
+
+		const size_t number_of_nodes;
+
+		NodeCostMap(size_t number_of_nodes) : number_of_nodes(number_of_nodes)
+		{
+			_costs = allocateCacheAlignedArray<NodeCost>(number_of_nodes);
+
+			reset();
+		}
+
+		~NodeCostMap() { deallocateCacheAlignedArray(_costs); }
+
+		NodeCostMap(const NodeCostMap &) = delete;
+		NodeCostMap & operator=(const NodeCostMap &) = delete;
+
+		inline void add(NodeCostKind kind, size_t node, std::uint64_t nanoseconds) { _costs[node].nanoseconds[kind] += nanoseconds; }
+
+		// Copies the time in s spent on each grid point since the last reset to costs
+		inline void copyCosts(NodeCostKind kind, real_t *costs) const
+		{
+			for (size_t i = 0; i < number_of_nodes; i++) costs[i] = _costs[i].nanoseconds[kind] * 1E-9;
+		}
+
+		inline void reset()
+		{
+			std::memset(_costs, 0, number_of_nodes * sizeof(NodeCost));
+		}
+};
+
+// Adds the time of its scope to node of node_cost_map, does nothing if node_cost_map is NULL
+class ScopedNodeCostTimer
+{
+	private:
+
+		NodeCostMap * const _node_cost_map;
+
+		const NodeCostKind _kind;
+		const size_t _node;
+
+		std::chrono::steady_clock::time_point _begin;
+
+	public:
+
+		inline ScopedNodeCostTimer(NodeCostMap *node_cost_map, NodeCostKind kind, size_t node) :
+			_node_cost_map(node_cost_map),
+			_kind(kind),
+			_node(node)
+		{
+			if (_node_cost_map != NULL) _begin = std::chrono::steady_clock::now();
+		}
+
+		inline ~ScopedNodeCostTimer()
+		{
+			if (_node_cost_map != NULL) _node_cost_map->add(
+				_kind,
+				_node,
+				std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _begin).count()
+			);
+		}
+};
+
+#endif
\ No newline at end of file
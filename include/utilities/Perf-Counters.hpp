@@ -0,0 +1,56 @@
+/**
+ * @file Perf-Counters.hpp
+ * @brief Per thread hardware performance counters read through Linux perf_event_open
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __PERF_COUNTERS__
+#define __PERF_COUNTERS__
+
+#include <cstdint>
+
+enum PerfCounter
+{
+	PERF_CYCLES,
+	PERF_INSTRUCTIONS,
+	PERF_CACHE_MISSES,
+
+	// Model specific event given by its raw code, for example on
+	// Intel cores 0x1eca for FP_ASSIST.ANY or 0x02c0 for INST_RETIRED.X87
+	PERF_RAW_EVENT,
+
+	NUMBER_OF_PERF_COUNTERS
+};
+
+struct PerfCounterValues
+{
+	std::uint64_t values[NUMBER_OF_PERF_COUNTERS];
+};
+
+// Returns name of counter as written in the profile
+const char * getPerfCounterName(PerfCounter counter);
+
+// Opens the counters on the calling thread, and on every other thread when it
+// first reads them. raw_event is the code of PERF_RAW_EVENT, 0 to not count it.
+// Counters the kernel or the processor does not support, for example in
+// containers or when perf_event_paranoid forbids them, are left out.
+// Returns false with a warning if no counter could be opened,
+// in which case reading the counters does nothing.
+bool enablePerfCounters(std::uint64_t raw_event = 0);
+
+extern bool perf_counters_enabled;
+
+inline bool arePerfCountersEnabled() { return perf_counters_enabled; }
+
+// Returns true if counter could be opened on the calling thread
+bool isPerfCounterAvailable(PerfCounter counter);
+
+// Reads the counters of the calling thread since they were opened into
+// counter_values, counters that are not available read 0
+void readPerfCounters(PerfCounterValues &counter_values);
+
+#endif
\ No newline at end of file
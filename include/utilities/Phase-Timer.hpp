@@ -0,0 +1,100 @@
+/**
+ * @file Phase-Timer.hpp
+ * @brief Per thread wall time of the phases of an iteration of the solver
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __PHASE_TIMER__
+#define __PHASE_TIMER__
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+#include "utilities/Perf-Counters.hpp"
+
+// Timed phases of an iteration. Phases nest, for example
+// the heat loss term is also counted in the boundary conditions,
+// so the time of each phase includes that of the phases within it.
+enum SolverPhase
+{
+	PHASE_BOUNDARY_CONDITIONS,
+	PHASE_TRANSIENT_TERM,
+	PHASE_HEAT_LOSS_TERM,
+	PHASE_PELLET_SOLVE,
+	PHASE_PARTICLE_UPDATE,
+	PHASE_THERMAL_CONDUCTIVITY,
+	PHASE_OUTPUT,
+
+	NUMBER_OF_SOLVER_PHASES
+};
+
+// Returns name of phase as written in the profile
+const char * getSolverPhaseName(SolverPhase phase);
+
+// Timers are off by default, when off a timer costs a single branch
+void enablePhaseTimers();
+
+extern bool phase_timers_enabled;
+
+inline bool arePhaseTimersEnabled() { return phase_timers_enabled; }
+
+// Adds nanoseconds to the time of phase of the calling thread, and the
+// change in performance counters since begin_counters if it is not NULL
+void addPhaseTime(SolverPhase phase, std::uint64_t nanoseconds, const PerfCounterValues *begin_counters = NULL);
+
+// Times its scope as phase on the calling thread, and counts the hardware events
+// in it when performance counters are enabled. Each thread accumulates
+// into its own counters, so timers never contend between threads.
+class ScopedPhaseTimer
+{
+	private:
+
+		const SolverPhase _phase;
+
+		std::chrono::steady_clock::time_point _begin;
+
+		PerfCounterValues _begin_counters;
+
+	public:
+
+		inline ScopedPhaseTimer(SolverPhase phase) : _phase(phase)
+		{
+			if (!phase_timers_enabled) return;
+
+			if (perf_counters_enabled) readPerfCounters(_begin_counters);
+
+			_begin = std::chrono::steady_clock::now();
+		}
+
+		inline ~ScopedPhaseTimer()
+		{
+			if (phase_timers_enabled) addPhaseTime(
+				_phase,
+				std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _begin).count(),
+				perf_counters_enabled ? &_begin_counters : NULL
+			);
+		}
+};
+
+// Copies the time in s of each phase summed over all threads to seconds,
+// NUMBER_OF_SOLVER_PHASES values. Safe to call while phases are timed.
+void getPhaseTimes(double *seconds);
+
+// Writes a row phase,thread,calls,time per thread and phase timed, time in s,
+// followed by the count of each hardware event if performance counters are enabled.
+// Must not be called while timed phases are running.
+void printPhaseProfileCSV(std::ostream &output_stream);
+
+// Writes the calls and time in s of each phase in total and per thread
+// as JSON, with the wall time in s of the run and the current and peak resident
+// memory in bytes of the process for reference. With performance
+// counters enabled, also the count of each available hardware event in total and per thread.
+// Must not be called while timed phases are running.
+void printPhaseProfileJSON(std::ostream &output_stream, double wall_time);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ * @file Profile-Formatter.hpp
+ * @brief Fast text formatting of profiles as delimited rows
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __PROFILE_FORMATTER__
+#define __PROFILE_FORMATTER__
+
+#include <cstddef>
+#include <cfloat>
+#include <ostream>
+
+#include "math/Data-Type.hpp"
+
+// Significant digits of the formatted values, the same as
+// the default precision of std::ostream. Zero formats each value
+// with the fewest digits that read back to exactly the same value.
+#define DEFAULT_SIGNIFICANT_DIGITS 6
+
+// Most significant digits of the formatted values, enough
+// for any long double to read back to exactly the same value
+#define MAX_SIGNIFICANT_DIGITS LDBL_DECIMAL_DIG
+
+// Sets the significant digits used by printProfile in all threads,
+// at most MAX_SIGNIFICANT_DIGITS
+void setSignificantDigits(int significant_digits);
+
+int getSignificantDigits();
+
+// Writes first_value followed by number_of_values values, separated by
+// delimiter and ending with a new line, to output_stream. Values are
+// formatted with std::to_chars into a buffer reused by each thread and
+// written to output_stream at once.
+void printProfile(
+	std::ostream &output_stream,
+	real_t first_value,
+	const real_t *values,
+	size_t number_of_values,
+	char delimiter = ','
+);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+/**
+ * @file Profile-Sink.hpp
+ * @brief Destinations of time stamped profiles written by the solvers
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __PROFILE_SINK__
+#define __PROFILE_SINK__
+
+#include <cstddef>
+#include <ostream>
+
+#include "math/Data-Type.hpp"
+
+class ProfileSink
+{
+	public:
+
+		virtual ~ProfileSink() { ; }
+
+		// Writes number_of_points values of a profile at time in s
+		virtual void writeProfile(real_t time, const real_t *values, size_t number_of_points) = 0;
+
+		// Pushes written profiles to the underlying file
+		virtual void flush() = 0;
+};
+
+// Writes each profile as a row of the CSV solution files
+class CSVProfileSink : public ProfileSink
+{
+	private:
+
+		std::ostream &_output_stream;
+
+		const char _delimiter;
+
+	public:
+
+		CSVProfileSink(std::ostream &output_stream, char delimiter = ',');
+
+		void writeProfile(real_t time, const real_t *values, size_t number_of_points);
+
+		void flush();
+};
+
+#endif
\ No newline at end of file
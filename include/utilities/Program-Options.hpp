@@ -2,6 +2,7 @@
 #define __PROGRAM_OPTIONS__
 
 #include <iostream>
+#include <vector>
 
 #include "utilities/ezOptionParser.hpp"
 
@@ -25,4 +26,152 @@ void setIgnitionLengthOption(ez::ezOptionParser &opt);
 
 double getIgnitionLengthOption(ez::ezOptionParser &opt, double default_value);
 
+void setDataDirectoryOption(ez::ezOptionParser &opt);
+
+std::string getDataDirectoryOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setDatabaseFileOption(ez::ezOptionParser &opt);
+
+std::string getDatabaseFileOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setPhiListOption(ez::ezOptionParser &opt);
+
+std::vector<double> getPhiListOption(ez::ezOptionParser &opt, std::vector<double> default_value);
+
+void setIgnitionTemperatureListOption(ez::ezOptionParser &opt);
+
+std::vector<double> getIgnitionTemperatureListOption(ez::ezOptionParser &opt, std::vector<double> default_value);
+
+void setIgnitionLengthListOption(ez::ezOptionParser &opt);
+
+std::vector<double> getIgnitionLengthListOption(ez::ezOptionParser &opt, std::vector<double> default_value);
+
+void setDiffusivityListOption(ez::ezOptionParser &opt);
+
+std::vector<std::string> getDiffusivityListOption(ez::ezOptionParser &opt, std::vector<std::string> default_value);
+
+void setCasesFileOption(ez::ezOptionParser &opt);
+
+std::string getCasesFileOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setCaseThreadsOption(ez::ezOptionParser &opt);
+
+int getCaseThreadsOption(ez::ezOptionParser &opt, int default_value);
+
+void setNodeThreadsOption(ez::ezOptionParser &opt);
+
+int getNodeThreadsOption(ez::ezOptionParser &opt, int default_value);
+
+void setMaxTimeOption(ez::ezOptionParser &opt);
+
+double getMaxTimeOption(ez::ezOptionParser &opt, double default_value);
+
+void setOutputFormatOption(ez::ezOptionParser &opt);
+
+std::string getOutputFormatOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setInputFileOption(ez::ezOptionParser &opt);
+
+std::string getInputFileOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setOutputFileOption(ez::ezOptionParser &opt);
+
+std::string getOutputFileOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setChunkFramesOption(ez::ezOptionParser &opt);
+
+int getChunkFramesOption(ez::ezOptionParser &opt, int default_value);
+
+void setPyramidLevelsOption(ez::ezOptionParser &opt);
+
+int getPyramidLevelsOption(ez::ezOptionParser &opt, int default_value);
+
+void setSignificantDigitsOption(ez::ezOptionParser &opt);
+
+int getSignificantDigitsOption(ez::ezOptionParser &opt, int default_value);
+
+void setRestartFileOption(ez::ezOptionParser &opt);
+
+std::string getRestartFileOption(ez::ezOptionParser &opt, std::string default_value);
+
+void setCheckpointIntervalOption(ez::ezOptionParser &opt);
+
+double getCheckpointIntervalOption(ez::ezOptionParser &opt, double default_value);
+
+void setSteadyToleranceOption(ez::ezOptionParser &opt);
+
+double getSteadyToleranceOption(ez::ezOptionParser &opt, double default_value);
+
+void setSteadyWindowOption(ez::ezOptionParser &opt);
+
+double getSteadyWindowOption(ez::ezOptionParser &opt, double default_value);
+
+void setSteadyDurationOption(ez::ezOptionParser &opt);
+
+double getSteadyDurationOption(ez::ezOptionParser &opt, double default_value);
+
+void setProfileOption(ez::ezOptionParser &opt);
+
+bool getProfileOption(ez::ezOptionParser &opt);
+
+void setPerfCountersOption(ez::ezOptionParser &opt);
+
+bool getPerfCountersOption(ez::ezOptionParser &opt);
+
+void setPerfRawEventOption(ez::ezOptionParser &opt);
+
+unsigned long long getPerfRawEventOption(ez::ezOptionParser &opt, unsigned long long default_value);
+
+void setTraceOption(ez::ezOptionParser &opt);
+
+int getTraceOption(ez::ezOptionParser &opt, int default_value);
+
+void setNodeCostsOption(ez::ezOptionParser &opt);
+
+bool getNodeCostsOption(ez::ezOptionParser &opt);
+
+void setMemoryBudgetOption(ez::ezOptionParser &opt);
+
+double getMemoryBudgetOption(ez::ezOptionParser &opt, double default_value);
+
+void setPinThreadsOption(ez::ezOptionParser &opt);
+
+bool getPinThreadsOption(ez::ezOptionParser &opt);
+
+void setBenchmarkNodesOption(ez::ezOptionParser &opt);
+
+int getBenchmarkNodesOption(ez::ezOptionParser &opt, int default_value);
+
+void setBenchmarkIterationsOption(ez::ezOptionParser &opt);
+
+int getBenchmarkIterationsOption(ez::ezOptionParser &opt, int default_value);
+
+void setBenchmarkWorkOption(ez::ezOptionParser &opt);
+
+int getBenchmarkWorkOption(ez::ezOptionParser &opt, int default_value);
+
+void setBenchmarkReactingNodesOption(ez::ezOptionParser &opt);
+
+int getBenchmarkReactingNodesOption(ez::ezOptionParser &opt, int default_value);
+
+void setBenchmarkReactingWorkOption(ez::ezOptionParser &opt);
+
+int getBenchmarkReactingWorkOption(ez::ezOptionParser &opt, int default_value);
+
+void setSpeciesTasksOption(ez::ezOptionParser &opt);
+
+int getSpeciesTasksOption(ez::ezOptionParser &opt, int default_value);
+
+void setTaskPipelineOption(ez::ezOptionParser &opt);
+
+bool getTaskPipelineOption(ez::ezOptionParser &opt);
+
+void setMetricsOption(ez::ezOptionParser &opt);
+
+bool getMetricsOption(ez::ezOptionParser &opt);
+
+void setWatchOption(ez::ezOptionParser &opt);
+
+int getWatchOption(ez::ezOptionParser &opt, int default_value);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,113 @@
+/**
+ * @file Property-Database.hpp
+ * @brief Compiled binary database of the numeric input data files
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __PROPERTY_DATABASE__
+#define __PROPERTY_DATABASE__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "math/Data-Type.hpp"
+
+#define PROPERTY_DATABASE_VERSION 2
+
+// Name of the environment variable holding the path to a compiled
+// property database. When set, all data is read from the database
+// instead of the text files in the data directory
+#define PROPERTY_DATABASE_ENVIRONMENT_VARIABLE "PELLET_PROPERTY_DATABASE"
+
+// Name of the environment variable holding the data directory the database
+// stands in for, data paths are looked up relative to it. Defaults to
+// PROPERTY_DATABASE_DEFAULT_ROOT, the data directory of the solvers.
+#define PROPERTY_DATABASE_ROOT_ENVIRONMENT_VARIABLE "PELLET_PROPERTY_DATABASE_ROOT"
+#define PROPERTY_DATABASE_DEFAULT_ROOT "data"
+
+class PropertyDatabase
+{
+	public:
+
+		struct Header
+		{
+			char magic[8];
+
+			std::uint32_t version;
+			std::uint32_t real_size;
+
+			std::uint64_t number_of_entries;
+			std::uint64_t payload_size;
+			std::uint64_t checksum;
+
+			// Pads the header so that the payload stays aligned for real_t
+			std::uint64_t reserved;
+		};
+
+		struct Entry
+		{
+			// Offsets in bytes from the start of the payload
+			std::uint64_t key_offset;
+			std::uint64_t values_offset;
+
+			std::uint32_t key_length;
+			std::uint32_t number_of_values;
+		};
+
+	private:
+
+		void * _mapped_memory;
+		size_t _mapped_size;
+
+		const Header * _header;
+		const Entry * _entries;
+		const char * _payload;
+
+		// Absolute path of the data directory the keys are relative to
+		std::string _data_root;
+
+		const Entry * findEntry(const std::string &key) const;
+
+		// Returns path of directory_name / file_name relative to the data root,
+		// or false if it lies outside the data root
+		bool getKey(const char *directory_name, const char *file_name, std::string &key) const;
+
+	public:
+
+		// Memory maps the compiled database and validates its header and checksum.
+		// Data paths are then looked up relative to the data directory data_root.
+		PropertyDatabase(const char *file_name, const char *data_root = PROPERTY_DATABASE_DEFAULT_ROOT);
+		~PropertyDatabase();
+
+		// Returns pointer to the values read from file_name in directory_name
+		// when the database was compiled, or NULL if no such file was compiled
+		const real_t * getValues(
+			const char *directory_name,
+			const char *file_name,
+			size_t &number_of_values
+		) const;
+
+		// Returns the names of the sub-directories of directory_name
+		// in the order they were compiled
+		std::vector<std::string> getSubDirectories(const char *directory_name) const;
+
+		// Returns the database named by the environment variable
+		// PELLET_PROPERTY_DATABASE, loaded on first call with the data root
+		// PELLET_PROPERTY_DATABASE_ROOT, or NULL if the variable is not set
+		static const PropertyDatabase * getLoadedDatabase();
+};
+
+// Joins directory and file names into an absolute path, relative paths are taken
+// from the working directory, and removes redundant '/', '.' and '..' components
+std::string normalizeDataPath(const char *directory_name, const char *file_name = "");
+
+// Reads all numeric *.txt files under directory_name recursively and writes
+// them to a single binary file, keyed by their paths relative to directory_name
+void compilePropertyDatabase(const char *directory_name, const char *database_file_name);
+
+#endif
\ No newline at end of file
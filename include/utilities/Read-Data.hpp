@@ -20,9 +20,9 @@ QuadraticExpression readQuadraticExpressionCoefficients(const char *directory_na
 
 IdealGas readIdealGasData(const char *directory_name);
 
-Phase readPhaseData(const char *directory_name);
+Phase readPhaseData(const char *directory_name, real_t sharpness_coefficient);
 
-CondensedSpecies readCondensedSpeciesData(const char *directory_name);
+CondensedSpecies readCondensedSpeciesData(const char *directory_name, real_t sharpness_coefficient);
 
 ArrheniusDiffusivityModel readArrheniusDiffusivityModelParameters(const char *directory_name);
 
@@ -0,0 +1,114 @@
+/**
+ * @file Simulation-Config.hpp
+ * @brief Runtime configuration of a pellet combustion simulation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __SIMULATION_CONFIG__
+#define __SIMULATION_CONFIG__
+
+#include <cstddef>
+#include <cstdint>
+
+#include "math/Data-Type.hpp"
+
+#include "thermo-physical-properties/Ideal-Gas.hpp"
+#include "thermo-physical-properties/Condensed-Species.hpp"
+#include "thermo-physical-properties/Arrhenius-Diffusivity-Model.hpp"
+
+// Holds the particle, pellet and PDE solver data of one simulation.
+// It is immutable after construction, hence a single object
+// can be shared by any number of particles and pellets,
+// including ones simulated concurrently.
+class SimulationConfig
+{
+	private:
+
+		real_t * _radial_coordinate_sqr;
+		real_t * _radial_coordinate_sqr_ratio;
+
+		// Not copyable as it owns the radial coordinate arrays
+		SimulationConfig(const SimulationConfig &);
+		SimulationConfig & operator = (const SimulationConfig &);
+
+	public:
+
+		// Core-shell particle
+		const real_t sharpness_coefficient;
+
+		const CondensedSpecies core_species;
+		const CondensedSpecies shell_species;
+		const CondensedSpecies product_species;
+
+		const ArrheniusDiffusivityModel diffusivity_model;
+
+		const real_t overall_radius;
+		const real_t core_radius;
+
+		// Masses in kg of a fresh particle
+		const real_t core_mass;
+		const real_t shell_mass;
+		const real_t particle_mass;
+
+		// Pellet
+		const real_t length;
+		const real_t diameter;
+
+		const real_t convective_heat_transfer_coefficient_curved_surface;
+		const real_t convective_heat_transfer_coefficient_flat_surface;
+		const real_t radiative_emissivity;
+
+		const real_t ambient_pressure;
+		const real_t ambient_temperature;
+
+		const IdealGas interstitial_gas;
+
+		// PDE solver
+		const real_t kappa;
+		const real_t gamma;
+
+		const real_t delta_t;
+		const real_t delta_T;
+
+		const size_t m;
+		const real_t delta_x;
+
+		const size_t n;
+		const real_t delta_r;
+
+		// Reads the data from the particle, pellet and PDE solver config directories.
+		// Diffusivity parameters are read from the diffusivity-parameters sub-directory
+		// of the particle directory, unless a separate directory is given.
+		SimulationConfig(
+			const char *particle_directory		= "data/core-shell-particle",
+			const char *pellet_directory		= "data/pellet",
+			const char *solver_directory		= "data/PDE-solver-config",
+			const char *diffusivity_directory	= NULL
+		);
+
+		~SimulationConfig();
+
+		// Squares of radial coordinates of the particle grid points in m^2
+		inline const real_t * getRadialCoordinateSqr() const
+		{
+			return _radial_coordinate_sqr;
+		}
+
+		// Ratio of squares of radial coordinates of adjacent
+		// particle grid points, r[i+1]^2 / r[i]^2
+		inline const real_t * getRadialCoordinateSqrRatio() const
+		{
+			return _radial_coordinate_sqr_ratio;
+		}
+
+		// Returns a 64 bit hash of the data, identifying configs that yield
+		// the same simulation. Species and diffusivity data are hashed through
+		// their properties sampled over the range of temperatures of combustion.
+		std::uint64_t getHash() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * @file Solver-Metrics.hpp
+ * @brief Progress of a running solver in a memory mapped file, for external monitors
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __SOLVER_METRICS__
+#define __SOLVER_METRICS__
+
+#include <atomic>
+#include <cstdint>
+#include <chrono>
+#include <string>
+
+#include "utilities/Phase-Timer.hpp"
+
+#define SOLVER_METRICS_VERSION 1
+
+// Attempts of a reader to copy the values between writes before giving up
+#define SOLVER_METRICS_READ_ATTEMPTS 1000000
+
+enum SolverState
+{
+	SOLVER_RUNNING,
+	SOLVER_COMPLETE,
+	SOLVER_INTERRUPTED
+};
+
+// Values published by the solver. Stored as doubles and fixed
+// width integers, so that monitors need not know the type of real_t.
+struct SolverMetricsValues
+{
+	std::uint64_t iteration;
+
+	// Grid points whose particles are still evolving
+	std::uint64_t reacting_nodes;
+
+	// Resident memory of the solver in bytes, refreshed at most once a second
+	std::uint64_t rss;
+	std::uint64_t peak_rss;
+
+	std::uint32_t state;
+	std::uint32_t reserved;
+
+	// Seconds since the Unix epoch when published, telling stalled runs from running ones
+	double update_time;
+
+	// Simulated time in s
+	double time;
+
+	// Iterations per s of wall time, over at least the last second
+	double step_rate;
+
+	// Position in m and speed in m/s of the flame front, NAN until there is a speed
+	double flame_front_position;
+	double flame_speed;
+
+	// Highest temperature in K across the pellet
+	double max_temperature;
+
+	// Time in s of each SolverPhase summed over threads, 0 unless phases are timed
+	double phase_times[NUMBER_OF_SOLVER_PHASES];
+};
+
+// Layout of the metrics file. The values are guarded by a sequence lock -
+// sequence is odd while the solver writes them, and a reader retries until
+// it reads the same even sequence before and after copying the values.
+struct SolverMetricsFile
+{
+	char magic[8];
+
+	std::uint32_t version;
+	std::uint32_t number_of_phases;
+
+	std::uint64_t pid;
+
+	std::atomic<std::uint64_t> sequence;
+
+	SolverMetricsValues values;
+};
+
+// Publishes metrics of a single solver thread to a memory mapped file,
+// without locks or system calls apart from reading the resident memory
+class SolverMetricsPublisher
+{
+	private:
+
+		SolverMetricsFile * _file;
+
+		// Rate is measured from the first publish, whose iteration
+		// is that of the checkpoint in restarted runs
+		bool _rate_begun;
+
+		std::chrono::steady_clock::time_point _rate_begin;
+		std::uint64_t _rate_begin_iteration;
+
+		double _step_rate;
+
+		std::chrono::steady_clock::time_point _last_rss_update;
+
+		std::uint64_t _rss;
+		std::uint64_t _peak_rss;
+
+	public:
+
+		// Creates file_name, replacing any earlier file
+		SolverMetricsPublisher(const std::string &file_name);
+		~SolverMetricsPublisher();
+
+		// Fills in the step rate, resident memory, phase times and update time of
+		// values and publishes them. Only one thread may publish to a file.
+		void publish(SolverMetricsValues &values);
+};
+
+// Memory maps a metrics file written by a solver for reading
+class SolverMetricsReader
+{
+	private:
+
+		const SolverMetricsFile * _file;
+
+	public:
+
+		// Warns and is not open if file_name is not a metrics file of this version of the solver
+		SolverMetricsReader(const std::string &file_name);
+		~SolverMetricsReader();
+
+		inline bool isOpen() const { return _file != NULL; }
+
+		// Returns process id of the solver
+		inline std::uint64_t getPID() const { return _file->pid; }
+
+		// Copies a consistent set of the latest values published to values, returns
+		// false if none could be read, as when the solver was killed while publishing
+		bool read(SolverMetricsValues &values) const;
+};
+
+// Returns name of state as displayed by monitors
+const char * getSolverStateName(SolverState state);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ * @file Thread-Affinity.hpp
+ * @brief Pins the threads solving the grid points to CPUs
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __THREAD_AFFINITY__
+#define __THREAD_AFFINITY__
+
+#include <sched.h>
+
+// Pins thread # t of the OpenMP team to the t-th CPU the process may run on,
+// wrapping around if there are more threads than CPUs. The runtime reuses the
+// same threads for later parallel regions of the same size, so each keeps its CPU,
+// and with it the memory node of the pages it touches first.
+// Threads started afterwards by the calling thread inherit the CPU of thread # 0,
+// unless started within an UnpinnedAffinityScope.
+// Returns the number of threads pinned, 0 if affinity could not be set.
+int pinOpenMPThreads();
+
+// Lets the calling thread run on all the CPUs the process could run on
+// before pinOpenMPThreads, until the scope ends. Threads started within
+// the scope inherit this affinity, so helper threads like writers do not
+// compete with OpenMP thread # 0 for its CPU. Does nothing if threads
+// were not pinned.
+class UnpinnedAffinityScope
+{
+	private:
+
+		bool _unpinned;
+
+		cpu_set_t _previous_cpus;
+
+	public:
+
+		UnpinnedAffinityScope();
+		~UnpinnedAffinityScope();
+
+		UnpinnedAffinityScope(const UnpinnedAffinityScope &) = delete;
+		UnpinnedAffinityScope & operator=(const UnpinnedAffinityScope &) = delete;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+/**
+ * @file Trace-Recorder.hpp
+ * @brief Per thread timeline of solver regions, written as a Chrome trace
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __TRACE_RECORDER__
+#define __TRACE_RECORDER__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+// Tracing is off by default, when off a traced scope costs a single branch.
+// When on, each thread records events into a ring buffer of its own holding its
+// last events_per_thread events, allocated on its first event, so recording takes
+// no locks. Once a buffer is full, each event overwrites the oldest one.
+void enableTracing(size_t events_per_thread);
+
+extern bool tracing_enabled;
+
+inline bool isTracingEnabled() { return tracing_enabled; }
+
+// Returns nanoseconds since tracing was enabled
+std::uint64_t getTraceTime();
+
+// Records event name from begin to end in ns on the calling thread, with
+// argument, for example a grid point index, or -1 if there is none.
+// name must outlive the trace, in practice a string literal.
+void recordTraceEvent(const char *name, std::uint64_t begin, std::uint64_t end, long argument);
+
+// Records its scope as event name on the calling thread
+class ScopedTraceEvent
+{
+	private:
+
+		const char * const _name;
+		const long _argument;
+
+		std::uint64_t _begin;
+
+	public:
+
+		inline ScopedTraceEvent(const char *name, long argument = -1) : _name(name), _argument(argument), _begin(0)
+		{
+			if (tracing_enabled) _begin = getTraceTime();
+		}
+
+		inline ~ScopedTraceEvent()
+		{
+			if (tracing_enabled) recordTraceEvent(_name, _begin, getTraceTime(), _argument);
+		}
+};
+
+// Returns number of events overwritten by later events as buffers were full
+size_t getNumberOfOverwrittenTraceEvents();
+
+// Writes the events held by all threads, oldest first, in the Chrome trace event format,
+// which opens in Perfetto and chrome://tracing.
+// Must not be called while traced scopes are running.
+void printChromeTrace(std::ostream &output_stream);
+
+#endif
\ No newline at end of file
@@ -9,6 +9,7 @@ import argparse
 sys.path.insert(0, os.path.dirname(os.path.split(sys.path[0])[0]))
 
 from scripts.utilities.solution_folder import getlatestfolder, getpath
+from scripts.utilities.frame_file import loadsolution
 
 folder = getlatestfolder()
 
@@ -38,7 +39,7 @@ if args.tmax :
 
 print('Processing solution at the directory ' + folder)
 
-data = np.genfromtxt(os.path.join(folder, 'temperature.csv'), delimiter=',')
+data = loadsolution(folder, 'temperature')
 
 t = data[1:, 0]
 x = data[0, 1:]
@@ -0,0 +1,280 @@
+# reading the binary frame files written with -output-format binary
+
+import os
+import struct
+import zlib
+
+import numpy as np
+
+FRAME_FILE_MAGIC = b'PELLETFR'
+FRAME_FILE_VERSION = 1
+
+# Layout of FrameFileHeader in utilities/Frame-File.hpp
+HEADER_FORMAT = '<8sIIIIQQQQQ'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+DATA_TYPES = {1 : np.float32, 2 : np.float64, 3 : np.longdouble}
+
+INDEX_DTYPE = np.dtype([('time', '<f8'), ('offset', '<u8')])
+
+# Returns the header fields and metadata of a frame file
+def readheader(file_name) :
+
+    with open(file_name, 'rb') as file :
+
+        magic, version, data_type, value_size, _, number_of_points, frame_size, frames_offset, number_of_frames, index_offset = struct.unpack(HEADER_FORMAT, file.read(HEADER_SIZE))
+
+        if magic != FRAME_FILE_MAGIC or version != FRAME_FILE_VERSION :
+
+            raise ValueError(file_name + ' is not a version ' + str(FRAME_FILE_VERSION) + ' frame file')
+
+        strings = []
+
+        for i in range(3) :
+
+            length, = struct.unpack('<I', file.read(4))
+            strings.append(file.read(length).decode())
+
+        grid_offset = (file.tell() + 15) // 16 * 16
+
+    return {
+        'dtype'             : np.dtype(DATA_TYPES[data_type]),
+        'value_size'        : value_size,
+        'number_of_points'  : number_of_points,
+        'frame_size'        : frame_size,
+        'frames_offset'     : frames_offset,
+        'number_of_frames'  : number_of_frames,
+        'index_offset'      : index_offset,
+        'grid_offset'       : grid_offset,
+        'quantity'          : strings[0],
+        'quantity_units'    : strings[1],
+        'grid_units'        : strings[2]
+    }
+
+# Returns times, grid points and values (frames x points) of a frame file
+def readframes(file_name) :
+
+    header = readheader(file_name)
+
+    dtype = header['dtype']
+    n = header['number_of_points']
+
+    if dtype.itemsize != header['value_size'] :
+
+        raise ValueError(file_name + ' stores ' + str(header['value_size']) + ' byte values')
+
+    data = np.fromfile(file_name, dtype=np.uint8)
+
+    grid = data[header['grid_offset'] : header['grid_offset'] + n * dtype.itemsize].view(dtype)
+
+    # Files not closed by the solver have no index, all complete frames are read
+    if header['index_offset'] :
+
+        number_of_frames = header['number_of_frames']
+
+    else :
+
+        number_of_frames = (data.size - header['frames_offset']) // header['frame_size']
+
+    frames = data[header['frames_offset'] : header['frames_offset'] + number_of_frames * header['frame_size']].view(dtype).reshape(number_of_frames, n + 1)
+
+    return frames[:, 0].astype(np.float64), grid.astype(np.float64), frames[:, 1:].astype(np.float64)
+
+COMPRESSED_FRAME_FILE_MAGIC = b'PELLETZF'
+COMPRESSED_FRAME_FILE_VERSION = 1
+
+# Layout of CompressedFrameFileHeader and CompressedFrameBlockHeader in utilities/Compressed-Frame-File.hpp
+COMPRESSED_HEADER_FORMAT = '<8sIIIIQQ'
+COMPRESSED_HEADER_SIZE = struct.calcsize(COMPRESSED_HEADER_FORMAT)
+
+COMPRESSED_BLOCK_HEADER_FORMAT = '<IIQdd'
+COMPRESSED_BLOCK_HEADER_SIZE = struct.calcsize(COMPRESSED_BLOCK_HEADER_FORMAT)
+
+# Returns times, grid points and values (frames x points) of a compressed frame file,
+# ignoring a block truncated by a crash
+def readcompressedframes(file_name) :
+
+    with open(file_name, 'rb') as file :
+
+        data = file.read()
+
+    magic, version, data_type, value_size, frames_per_block, number_of_points, _ = struct.unpack_from(COMPRESSED_HEADER_FORMAT, data)
+
+    if magic != COMPRESSED_FRAME_FILE_MAGIC or version != COMPRESSED_FRAME_FILE_VERSION :
+
+        raise ValueError(file_name + ' is not a version ' + str(COMPRESSED_FRAME_FILE_VERSION) + ' compressed frame file')
+
+    dtype = np.dtype(DATA_TYPES[data_type])
+
+    if dtype.itemsize != value_size :
+
+        raise ValueError(file_name + ' stores ' + str(value_size) + ' byte values')
+
+    position = COMPRESSED_HEADER_SIZE
+
+    for i in range(3) :
+
+        length, = struct.unpack_from('<I', data, position)
+        position += 4 + length
+
+    grid = np.frombuffer(data, dtype=dtype, count=number_of_points, offset=position)
+
+    position += number_of_points * value_size
+
+    frame_size = (number_of_points + 1) * value_size
+
+    blocks = []
+
+    while position + COMPRESSED_BLOCK_HEADER_SIZE <= len(data) :
+
+        number_of_frames, _, compressed_size, _, _ = struct.unpack_from(COMPRESSED_BLOCK_HEADER_FORMAT, data, position)
+
+        position += COMPRESSED_BLOCK_HEADER_SIZE
+
+        if number_of_frames == 0 or position + compressed_size > len(data) :
+
+            break
+
+        shuffled = np.frombuffer(zlib.decompress(data[position : position + compressed_size]), dtype=np.uint8)
+
+        # Undo the byte shuffle, then the XOR of each frame with the frame before it
+        frames = shuffled.reshape(value_size, -1).T.reshape(number_of_frames, frame_size)
+
+        blocks.append(np.bitwise_xor.accumulate(frames, axis=0))
+
+        position += compressed_size
+
+    frames = np.concatenate(blocks).view(dtype) if blocks else np.empty((0, number_of_points + 1), dtype)
+
+    return frames[:, 0].astype(np.float64), grid.astype(np.float64), frames[:, 1:].astype(np.float64)
+
+CHUNK_INDEX_MAGIC = b'PELLETIX'
+CHUNK_INDEX_VERSION = 1
+
+# Layout of ChunkIndexHeader and ChunkIndexEntry in utilities/Chunked-Frame-File.hpp
+CHUNK_INDEX_HEADER_FORMAT = '<8sIIQQ'
+CHUNK_INDEX_HEADER_SIZE = struct.calcsize(CHUNK_INDEX_HEADER_FORMAT)
+
+CHUNK_INDEX_DTYPE = np.dtype([('time', '<f8'), ('chunk', '<u4'), ('reserved', '<u4'), ('offset', '<u8')])
+
+# Returns path of chunk # chunk in a chunked frame directory
+def chunkfilename(directory, chunk) :
+
+    return os.path.join(directory, 'chunk-%05d.frames' % chunk)
+
+# Returns the index entries of a chunked frame directory, memory mapped
+def readchunkindex(directory) :
+
+    file_name = os.path.join(directory, 'index.bin')
+
+    with open(file_name, 'rb') as file :
+
+        magic, version, _, number_of_points, frames_per_chunk = struct.unpack(CHUNK_INDEX_HEADER_FORMAT, file.read(CHUNK_INDEX_HEADER_SIZE))
+
+    if magic != CHUNK_INDEX_MAGIC or version != CHUNK_INDEX_VERSION :
+
+        raise ValueError(directory + ' is not a version ' + str(CHUNK_INDEX_VERSION) + ' chunked frame directory')
+
+    # Entries are appended as frames are written, a partly written entry is ignored
+    number_of_frames = (os.path.getsize(file_name) - CHUNK_INDEX_HEADER_SIZE) // CHUNK_INDEX_DTYPE.itemsize
+
+    return np.memmap(file_name, dtype=CHUNK_INDEX_DTYPE, mode='r', offset=CHUNK_INDEX_HEADER_SIZE, shape=(number_of_frames,))
+
+# Returns times, grid points and values (frames x points) of the frames
+# from tmin to tmax of a chunked frame directory. Only the chunks
+# holding these frames are mapped, the rest are not read at all.
+def readchunkedframes(directory, tmin=-np.inf, tmax=np.inf) :
+
+    index = readchunkindex(directory)
+
+    begin = np.searchsorted(index['time'], tmin, 'left')
+    end = np.searchsorted(index['time'], tmax, 'right')
+
+    header = readheader(chunkfilename(directory, 0))
+
+    dtype = header['dtype']
+    n = header['number_of_points']
+
+    grid = np.fromfile(chunkfilename(directory, 0), dtype=dtype, count=n, offset=header['grid_offset'])
+
+    times = np.empty(end - begin)
+    values = np.empty((end - begin, n))
+
+    frame = begin
+
+    while frame < end :
+
+        chunk = index['chunk'][frame]
+
+        # Frames of a chunk are contiguous
+        count = min(end, np.searchsorted(index['chunk'], chunk, 'right')) - frame
+
+        offset = int(index['offset'][frame])
+
+        frames = np.memmap(chunkfilename(directory, chunk), dtype=np.uint8, mode='r')[offset : offset + count * header['frame_size']].view(dtype).reshape(count, n + 1)
+
+        times[frame - begin : frame - begin + count] = frames[:, 0]
+        values[frame - begin : frame - begin + count] = frames[:, 1:]
+
+        frame += count
+
+    return times, grid.astype(np.float64), values
+
+# Returns solution name from folder in the layout of the CSV solution files,
+# first row [nan, grid points] and then a row [time, values] per frame,
+# reading the frames from tmin to tmax of name.chunks if present,
+# else name.zframes or name.frames if present, else name.csv
+def loadsolution(folder, name, tmin=-np.inf, tmax=np.inf) :
+
+    chunked_directory = os.path.join(folder, name + '.chunks')
+    compressed_file_name = os.path.join(folder, name + '.zframes')
+    frame_file_name = os.path.join(folder, name + '.frames')
+
+    if os.path.isdir(chunked_directory) :
+
+        t, x, values = readchunkedframes(chunked_directory, tmin, tmax)
+
+    elif os.path.exists(compressed_file_name) :
+
+        t, x, values = readcompressedframes(compressed_file_name)
+
+    elif os.path.exists(frame_file_name) :
+
+        t, x, values = readframes(frame_file_name)
+
+    else :
+
+        data = np.genfromtxt(os.path.join(folder, name + '.csv'), delimiter=',')
+
+        t, x, values = data[1:, 0], data[0, 1:], data[1:, 1:]
+
+    window = np.logical_and(t >= tmin, t <= tmax)
+
+    t, values = t[window], values[window]
+
+    data = np.empty((t.size + 1, x.size + 1))
+
+    data[0, 0] = np.nan
+    data[0, 1:] = x
+
+    data[1:, 0] = t
+    data[1:, 1:] = values
+
+    return data
+# Returns level # level of the decimated levels of solution name from folder,
+# written with -pyramid-levels, in the layout of loadsolution. Each value is
+# the minimum or maximum, as extreme is 'min' or 'max', over a block of
+# 2^level grid points by 2^level frames, at the block midpoint and first time.
+def loadpyramidlevel(folder, name, level, extreme='max') :
+
+    t, x, values = readframes(os.path.join(folder, name + '.pyramid', 'level-%d-%s.frames' % (level, extreme)))
+
+    data = np.empty((t.size + 1, x.size + 1))
+
+    data[0, 0] = np.nan
+    data[0, 1:] = x
+
+    data[1:, 0] = t
+    data[1:, 1:] = values
+
+    return data
\ No newline at end of file
@@ -9,6 +9,7 @@ import argparse
 sys.path.insert(0, os.path.dirname(os.path.split(sys.path[0])[0]))
 
 from scripts.utilities.solution_folder import getlatestfolder, getpath
+from scripts.utilities.frame_file import loadsolution
 
 folder = getlatestfolder()
 
@@ -24,8 +25,8 @@ if args.folderpath :
 
 print('Processing solution at the directory ' + folder)
 
-dataA = np.genfromtxt(os.path.join(folder, 'concentration_A.csv'), delimiter=',')
-dataB = np.genfromtxt(os.path.join(folder, 'concentration_B.csv'), delimiter=',')
+dataA = loadsolution(folder, 'concentration_A')
+dataB = loadsolution(folder, 'concentration_B')
 
 t = dataA[1:, 0]
 x = dataA[0, 1:]
@@ -0,0 +1,61 @@
+import numpy as np
+import matplotlib.pyplot as plt
+
+import os
+import sys
+
+import argparse
+
+sys.path.insert(0, os.path.dirname(os.path.split(sys.path[0])[0]))
+
+from scripts.utilities.solution_folder import getlatestfolder, getpath
+from scripts.utilities.frame_file import loadsolution
+
+folder = getlatestfolder()
+
+parser = argparse.ArgumentParser()
+
+parser.add_argument("-f", "--folderpath", help="Path to folder containing node-cost-*.csv, written with -node-costs")
+parser.add_argument("-s", "--savefigure", help="Save heatmap", action='store_true')
+
+args = parser.parse_args()
+
+if args.folderpath :
+
+	folder = args.folderpath
+
+print('Processing solution at the directory ' + folder)
+
+temperature = loadsolution(folder, 'temperature')
+
+fig, axes = plt.subplots(1, 2, sharey=True, constrained_layout=True)
+
+for axis, name, title in zip(axes, ['node-cost-transient-term', 'node-cost-particle-update'], ['Transient Term', 'Particle Update']) :
+
+	data = np.genfromtxt(os.path.join(folder, name + '.csv'), delimiter=',')
+
+	t = data[1:, 0]
+	x = data[0, 1:] * 1E3
+
+	# Time per grid point per output interval
+	cost = data[1:, 1:] * 1E3
+
+	mesh = axis.pcolormesh(x, t, cost, cmap='magma', shading='nearest')
+
+	# Flame front, to compare with where the cost concentrates
+	rows = min(temperature.shape[0] - 1, t.size)
+
+	axis.contour(temperature[0, 1:] * 1E3, temperature[1 : rows + 1, 0], temperature[1 : rows + 1, 1:], levels=[1000], colors='cyan', linewidths=0.5)
+
+	axis.set_xlabel('x (mm)')
+	axis.set_title(title)
+
+	fig.colorbar(mesh, ax=axis, label='Time per output interval (ms)')
+
+axes[0].set_ylabel('t (s)')
+
+plt.show()
+
+if args.savefigure :
+
+	fig.savefig(folder + '/node_cost_heatmap.jpeg', dpi=600)
\ No newline at end of file
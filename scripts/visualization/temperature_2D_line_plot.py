@@ -9,6 +9,7 @@ import argparse
 sys.path.insert(0, os.path.dirname(os.path.split(sys.path[0])[0]))
 
 from scripts.utilities.solution_folder import getlatestfolder, getpath
+from scripts.utilities.frame_file import loadsolution
 
 folder = getlatestfolder()
 
@@ -17,15 +18,29 @@ parser = argparse.ArgumentParser()
 parser.add_argument("-f", "--folderpath", help="Path to folder containing temperature.csv")
 parser.add_argument("-s", "--savefigure", help="Save temperature plot", action='store_true')
 
+parser.add_argument("--tmin", help="Plot temperature profiles starting from time ARG")
+parser.add_argument("--tmax", help="Plot temperature profiles upto time ARG")
+
 args = parser.parse_args()
 
 if args.folderpath :
 
 	folder = args.folderpath
 
+tmin, tmax = 0, np.inf
+
+if args.tmin :
+
+	tmin = float(args.tmin)
+
+if args.tmax :
+
+	tmax = float(args.tmax)
+
 print('Processing solution at the directory ' + folder)
 
-data = np.genfromtxt(os.path.join(folder, 'temperature.csv'), delimiter=',')
+# Only frames within the time window are read from chunked solutions
+data = loadsolution(folder, 'temperature', tmin, tmax)
 
 t = data[1:, 0]
 x = data[0, 1:] * 1E3
@@ -5,15 +5,36 @@ from mpl_toolkits.mplot3d import Axes3D
 import os
 import sys
 
+import argparse
+
 sys.path.insert(0, os.path.dirname(os.path.split(sys.path[0])[0]))
 
 from scripts.utilities.solution_folder import getlatestfolder, getpath
+from scripts.utilities.frame_file import loadsolution, loadpyramidlevel
 
 folder = getlatestfolder()
 
+parser = argparse.ArgumentParser()
+
+parser.add_argument("-f", "--folderpath", help="Path to folder containing temperature.csv")
+parser.add_argument("--level", help="Plot maximum temperatures of decimated level ARG, written with -pyramid-levels", type=int, default=0)
+
+args = parser.parse_args()
+
+if args.folderpath :
+
+	folder = args.folderpath
+
 print('Processing solution at the directory ' + folder)
 
-data = np.genfromtxt(os.path.join(folder, 'temperature.csv'), delimiter=',')
+# Decimated levels keep the surface small enough to render for long runs
+if args.level > 0 :
+
+	data = loadpyramidlevel(folder, 'temperature', args.level)
+
+else :
+
+	data = loadsolution(folder, 'temperature')
 
 t = data[1:, 0]
 x = data[0, 1:]
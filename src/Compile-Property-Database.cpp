@@ -0,0 +1,44 @@
+#include <iostream>
+#include <string>
+
+#include "utilities/Program-Options.hpp"
+#include "utilities/Property-Database.hpp"
+
+std::string data_directory = "data";
+std::string database_file = "property-database.bin";
+
+void parseProgramOptions(int argc, char const *argv[]);
+
+int main(int argc, char const *argv[])
+{
+	parseProgramOptions(argc, argv);
+
+	compilePropertyDatabase(data_directory.c_str(), database_file.c_str());
+
+	// Validate the compiled database the same way the solvers load it
+	PropertyDatabase property_database(database_file.c_str());
+
+	std::cout << "Set " << PROPERTY_DATABASE_ENVIRONMENT_VARIABLE << "=" << database_file << " to read input data from the database.\n";
+
+	return 0;
+}
+
+void parseProgramOptions(int argc, char const *argv[])
+{
+	ez::ezOptionParser opt;
+
+	opt.overview	= "Compiles the numeric input data files into a single binary property database.";
+	opt.syntax		= "Compile-Property-Database [OPTIONS]";
+	opt.example		= "Compile-Property-Database -data data -db property-database.bin\n\n";
+
+	setHelpOption(opt);
+	setDataDirectoryOption(opt);
+	setDatabaseFileOption(opt);
+
+	opt.parse(argc, argv);
+
+	displayHelpOption(opt);
+
+	data_directory	= getDataDirectoryOption(opt, data_directory);
+	database_file	= getDatabaseFileOption(opt, database_file);
+}
\ No newline at end of file
@@ -1,32 +1,104 @@
 #include <iostream>
+#include <vector>
 
 #include "pde-problems/Core-Shell-Diffusion.hpp"
 
 #include "utilities/Keyboard-Interrupt.hpp"
 #include "utilities/Program-Options.hpp"
 #include "utilities/File-Generator.hpp"
+#include "utilities/Async-Profile-Writer.hpp"
+#include "utilities/Chunked-Frame-File.hpp"
+#include "utilities/Compressed-Frame-File.hpp"
+#include "utilities/Profile-Formatter.hpp"
 
 #define MAX_ITER 1E8
 
 long double temperature = 1900;
 
+std::string output_format = "csv";
+
+int chunk_frames = 1000;
+
 void parseProgramOptions(int argc, char const *argv[]);
 
+void printConcentrationProfiles(
+	CoreShellDiffusion &particle,
+	AsyncProfileWriter &conc_A_writer,
+	AsyncProfileWriter &conc_B_writer,
+	real_t simulation_time
+);
+
 int main(int argc, char const *argv[])
 {
 	parseProgramOptions(argc, argv);
 
-    CoreShellDiffusion::setUpRadiusArray();
+	SimulationConfig config;
 
-    CoreShellDiffusion Ni_clad_Al_particle;
+    CoreShellDiffusion Ni_clad_Al_particle(config);
 
     FileGenerator file_generator;
 
-    std::ofstream conc_A_file = file_generator.getCSVFile("concentration_A");
-    std::ofstream conc_B_file = file_generator.getCSVFile("concentration_B");
+    std::ofstream conc_A_file;
+    std::ofstream conc_B_file;
+
+	ProfileSink *conc_A_sink;
+	ProfileSink *conc_B_sink;
+
+	if (output_format == "binary")
+	{
+		conc_A_file = file_generator.getFrameFile("concentration_A");
+		conc_B_file = file_generator.getFrameFile("concentration_B");
+
+		std::vector<real_t> grid_points(Ni_clad_Al_particle.n);
+		Ni_clad_Al_particle.getGridPoints(grid_points.data());
+
+		conc_A_sink = new FrameWriter(conc_A_file, Ni_clad_Al_particle.n, grid_points.data(), "concentration_A", "mol/m3", "m");
+		conc_B_sink = new FrameWriter(conc_B_file, Ni_clad_Al_particle.n, grid_points.data(), "concentration_B", "mol/m3", "m");
+	}
+
+	else if (output_format == "chunked")
+	{
+		std::vector<real_t> grid_points(Ni_clad_Al_particle.n);
+		Ni_clad_Al_particle.getGridPoints(grid_points.data());
+
+		conc_A_sink = new ChunkedFrameWriter(
+			file_generator.getFolderName() + "/concentration_A.chunks",
+			Ni_clad_Al_particle.n, grid_points.data(), "concentration_A", "mol/m3", "m", chunk_frames
+		);
+
+		conc_B_sink = new ChunkedFrameWriter(
+			file_generator.getFolderName() + "/concentration_B.chunks",
+			Ni_clad_Al_particle.n, grid_points.data(), "concentration_B", "mol/m3", "m", chunk_frames
+		);
+	}
+
+	else if (output_format == "compressed")
+	{
+		conc_A_file = file_generator.getCompressedFrameFile("concentration_A");
+		conc_B_file = file_generator.getCompressedFrameFile("concentration_B");
+
+		std::vector<real_t> grid_points(Ni_clad_Al_particle.n);
+		Ni_clad_Al_particle.getGridPoints(grid_points.data());
+
+		conc_A_sink = new CompressedFrameWriter(conc_A_file, Ni_clad_Al_particle.n, grid_points.data(), "concentration_A", "mol/m3", "m");
+		conc_B_sink = new CompressedFrameWriter(conc_B_file, Ni_clad_Al_particle.n, grid_points.data(), "concentration_B", "mol/m3", "m");
+	}
 
-    Ni_clad_Al_particle.printGridPoints(conc_A_file, ',');
-    Ni_clad_Al_particle.printGridPoints(conc_B_file, ',');
+	else
+	{
+		conc_A_file = file_generator.getCSVFile("concentration_A");
+		conc_B_file = file_generator.getCSVFile("concentration_B");
+
+		Ni_clad_Al_particle.printGridPoints(conc_A_file, ',');
+		Ni_clad_Al_particle.printGridPoints(conc_B_file, ',');
+
+		conc_A_sink = new CSVProfileSink(conc_A_file, ',');
+		conc_B_sink = new CSVProfileSink(conc_B_file, ',');
+	}
+
+	// Profiles are formatted and written on separate threads
+	AsyncProfileWriter *conc_A_writer = new AsyncProfileWriter(*conc_A_sink, Ni_clad_Al_particle.n);
+	AsyncProfileWriter *conc_B_writer = new AsyncProfileWriter(*conc_B_sink, Ni_clad_Al_particle.n);
 
     setUpKeyboardInterrupt();
 
@@ -34,7 +106,7 @@ int main(int argc, char const *argv[])
 
     try
     {
-		size_t step = 0.001 / CoreShellDiffusion::delta_t;
+		size_t step = 0.001 / Ni_clad_Al_particle.delta_t;
 
 		bool combustion_complete = false;
 
@@ -47,13 +119,12 @@ int main(int argc, char const *argv[])
 				Ni_clad_Al_particle.setUpEquations(temperature);
             	Ni_clad_Al_particle.solveEquations();
 
-				simulation_time += CoreShellDiffusion::delta_t;
+				simulation_time += Ni_clad_Al_particle.delta_t;
 
 				combustion_complete = Ni_clad_Al_particle.isCombustionComplete();           
 			}
 
-			Ni_clad_Al_particle.printConcentrationProfileA(conc_A_file, ',', simulation_time);
-            Ni_clad_Al_particle.printConcentrationProfileB(conc_B_file, ',', simulation_time);
+			printConcentrationProfiles(Ni_clad_Al_particle, *conc_A_writer, *conc_B_writer, simulation_time);
 
 			std::cout << "Iterations Completed : " << i << "\n";
 		}
@@ -63,8 +134,13 @@ int main(int argc, char const *argv[])
     {
         std::cout << "\nCaught signal " << e.S << "\nQuitting..." << std::endl;
 
-		Ni_clad_Al_particle.printConcentrationProfileA(conc_A_file, ',', simulation_time);
-		Ni_clad_Al_particle.printConcentrationProfileB(conc_B_file, ',', simulation_time);
+		printConcentrationProfiles(Ni_clad_Al_particle, *conc_A_writer, *conc_B_writer, simulation_time);
+
+		delete conc_A_writer;
+		delete conc_B_writer;
+
+		delete conc_A_sink;
+		delete conc_B_sink;
 
         conc_A_file.close();
         conc_B_file.close();
@@ -72,11 +148,15 @@ int main(int argc, char const *argv[])
         return 1;
     }
 
+	delete conc_A_writer;
+	delete conc_B_writer;
+
+	delete conc_A_sink;
+	delete conc_B_sink;
+
     conc_A_file.close();
     conc_B_file.close();
 
-	CoreShellDiffusion::deallocateRadiusArray();
-    
     return 0;
 }
 
@@ -91,10 +171,33 @@ void parseProgramOptions(int argc, char const *argv[])
 
 	setHelpOption(opt);
 	setTemperatureOption(opt);
+	setOutputFormatOption(opt);
+	setChunkFramesOption(opt);
+	setSignificantDigitsOption(opt);
 	
 	opt.parse(argc, argv);
 
 	displayHelpOption(opt);
 	
 	temperature = getTemperatureOption(opt, temperature);
+
+	output_format = getOutputFormatOption(opt, output_format);
+
+	chunk_frames = getChunkFramesOption(opt, chunk_frames);
+
+	setSignificantDigits(getSignificantDigitsOption(opt, DEFAULT_SIGNIFICANT_DIGITS));
+}
+
+// Snapshots the concentration profiles for the writer threads
+void printConcentrationProfiles(
+	CoreShellDiffusion &particle,
+	AsyncProfileWriter &conc_A_writer,
+	AsyncProfileWriter &conc_B_writer,
+	real_t simulation_time
+) {
+	particle.copyConcentrationProfileA(conc_A_writer.acquireBuffer());
+	conc_A_writer.submitBuffer(simulation_time);
+
+	particle.copyConcentrationProfileB(conc_B_writer.acquireBuffer());
+	conc_B_writer.submitBuffer(simulation_time);
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cmath>
+
+#include <sys/stat.h>
+
+#include "utilities/Program-Options.hpp"
+#include "utilities/Profile-Formatter.hpp"
+#include "utilities/Frame-File.hpp"
+#include "utilities/Chunked-Frame-File.hpp"
+#include "utilities/Compressed-Frame-File.hpp"
+
+std::string input_file = "";
+std::string output_file = "";
+
+void parseProgramOptions(int argc, char const *argv[]);
+
+// Writes all frames of frame_reader to output_file in the layout of the CSV solution files
+template<class frame_reader_t>
+void exportFrames(frame_reader_t &frame_reader)
+{
+	std::ofstream csv_file(output_file.c_str());
+
+	if (csv_file.fail())
+	{
+		std::cerr << "[ERROR] Could not create file - " << output_file << std::endl;
+		std::abort();
+	}
+
+	size_t number_of_points = frame_reader.getNumberOfPoints();
+
+	// Same layout as the CSV solution files, the first row holds the grid points
+	printProfile(csv_file, NAN, frame_reader.getGridPoints(), number_of_points, ',');
+
+	std::vector<real_t> values(number_of_points);
+
+	for (size_t frame = 0; frame < frame_reader.getNumberOfFrames(); frame++)
+	{
+		real_t time;
+
+		frame_reader.readFrame(frame, time, values.data());
+
+		printProfile(csv_file, time, values.data(), number_of_points, ',');
+	}
+
+	csv_file.close();
+
+	std::cout << "Exported " << frame_reader.getNumberOfFrames() << " frames of " << frame_reader.getQuantity();
+	std::cout << " (" << frame_reader.getQuantityUnits() << ") to " << output_file << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+	parseProgramOptions(argc, argv);
+
+	struct stat input_status;
+
+	// Chunked frame files are directories
+	if (stat(input_file.c_str(), &input_status) == 0 && S_ISDIR(input_status.st_mode))
+	{
+		ChunkedFrameReader frame_reader(input_file.c_str());
+
+		exportFrames(frame_reader);
+	}
+
+	else if (input_file.size() > 8 && input_file.compare(input_file.size() - 8, 8, ".zframes") == 0)
+	{
+		CompressedFrameReader frame_reader(input_file.c_str());
+
+		exportFrames(frame_reader);
+	}
+
+	else
+	{
+		FrameReader frame_reader(input_file.c_str());
+
+		exportFrames(frame_reader);
+	}
+
+	return 0;
+}
+
+void parseProgramOptions(int argc, char const *argv[])
+{
+	ez::ezOptionParser opt;
+
+	opt.overview	= "Exports a binary frame file, a directory of chunked frame files or a compressed frame file to the CSV format of the solution files.";
+	opt.syntax		= "Export-Frames-CSV [OPTIONS]";
+	opt.example		= "Export-Frames-CSV -i temperature.frames -o temperature.csv\n\n";
+
+	setHelpOption(opt);
+	setInputFileOption(opt);
+	setOutputFileOption(opt);
+	setSignificantDigitsOption(opt);
+
+	opt.parse(argc, argv);
+
+	displayHelpOption(opt);
+
+	input_file	= getInputFileOption(opt, input_file);
+	output_file	= getOutputFileOption(opt, output_file);
+
+	setSignificantDigits(getSignificantDigitsOption(opt, DEFAULT_SIGNIFICANT_DIGITS));
+
+	if (input_file.empty() || output_file.empty())
+	{
+		std::cerr << "Both input frame file and output CSV file should be given.\n";
+		std::abort();
+	}
+}
\ No newline at end of file
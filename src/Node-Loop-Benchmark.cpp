@@ -0,0 +1,180 @@
+#include <iostream>
+#include <chrono>
+
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+#include "pde-problems/Pellet-Flame-Propagation.hpp"
+
+#include "lusolver/LU-Solver.hpp"
+
+#include "utilities/Cache-Aligned-Array.hpp"
+#include "utilities/Program-Options.hpp"
+
+int number_of_nodes = 1001;
+int number_of_iterations = 10000;
+
+// Arithmetic operations per grid point, standing in for the work between writes
+int work = 0;
+
+// Consecutive grid points in the middle doing reacting_work operations instead,
+// standing in for the narrow reaction zone where particles are solved
+int number_of_reacting_nodes = 32;
+int reacting_work = 10000;
+
+void parseProgramOptions(int argc, char const *argv[]);
+
+// Returns a value for grid point # i after the work of the grid point
+inline real_t doWork(size_t i, int iteration)
+{
+	const size_t first_reacting_node = number_of_nodes / 2;
+
+	int operations = i >= first_reacting_node && i < first_reacting_node + number_of_reacting_nodes ? reacting_work : work;
+
+	real_t value = i + iteration;
+
+	for (int k = 0; k < operations; k++) value = 0.999 * value + 1E-3;
+
+	return value;
+}
+
+// Returns wall time in s per iteration of a loop writing the per grid point
+// outputs of the pellet loops to separate arrays and directly to the solver,
+// with chunk grid points handed to a thread at a time
+double timeArrayLoop(
+	size_t chunk,
+	real_t *thermal_conductivity,
+	real_t *prev_enthalpy_particle,
+	LUSolver &solver
+) {
+	const size_t m = number_of_nodes;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	for (int iteration = 0; iteration < number_of_iterations; iteration++)
+	{
+		#pragma omp parallel for default(shared) schedule(static, chunk)
+
+			for (size_t i = 1; i < m-1; i++)
+			{
+				real_t value = doWork(i, iteration);
+
+				prev_enthalpy_particle[i]	= value;
+				thermal_conductivity[i]		= 2. * value;
+
+				solver.setEquation(i, - value, 3. * value, - value, value);
+			}
+	}
+
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / number_of_iterations;
+}
+
+// Returns wall time in s per iteration of a loop writing the per grid point
+// outputs as the pellet does, to the padded node values of each grid point
+// one grid point at a time, then copying the equations to the solver in order
+double timeNodeValuesLoop(PelletNodeValues *node_values, LUSolver &solver)
+{
+	const size_t m = number_of_nodes;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	for (int iteration = 0; iteration < number_of_iterations; iteration++)
+	{
+		#pragma omp parallel for default(shared) schedule(static, 1)
+
+			for (size_t i = 1; i < m-1; i++)
+			{
+				real_t value = doWork(i, iteration);
+
+				node_values[i].prev_enthalpy_particle	= value;
+				node_values[i].thermal_conductivity		= 2. * value;
+
+				node_values[i].e = - value;
+				node_values[i].f = 3. * value;
+				node_values[i].g = - value;
+				node_values[i].b = value;
+			}
+
+		for (size_t i = 1; i < m-1; i++) solver.setEquation(i, node_values[i].e, node_values[i].f, node_values[i].g, node_values[i].b);
+	}
+
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / number_of_iterations;
+}
+
+int main(int argc, char const *argv[])
+{
+	parseProgramOptions(argc, argv);
+
+	#ifdef _OPENMP
+		int number_of_threads = omp_get_max_threads();
+	#else
+		int number_of_threads = 1;
+	#endif
+
+	std::cout << "Writing " << number_of_nodes << " grid points with " << number_of_threads << " threads, ";
+	std::cout << work << " operations per grid point, " << reacting_work << " per reacting grid point for ";
+	std::cout << number_of_reacting_nodes << " grid points.\n\n";
+
+	LUSolver solver(number_of_nodes);
+
+	// Grid points sharing a cache line in arrays of real_t
+	const size_t nodes_per_line = CACHE_LINE_SIZE / sizeof(real_t);
+
+	real_t *thermal_conductivity	= allocateCacheAlignedArray<real_t>(number_of_nodes, 1);
+	real_t *prev_enthalpy_particle	= allocateCacheAlignedArray<real_t>(number_of_nodes, 1);
+
+	// Warm up the threads and touch the pages
+	timeArrayLoop(1, thermal_conductivity, prev_enthalpy_particle, solver);
+
+	double interleaved_time = timeArrayLoop(1, thermal_conductivity, prev_enthalpy_particle, solver);
+
+	timeArrayLoop(nodes_per_line, thermal_conductivity, prev_enthalpy_particle, solver);
+
+	double blocked_time = timeArrayLoop(nodes_per_line, thermal_conductivity, prev_enthalpy_particle, solver);
+
+	deallocateCacheAlignedArray(thermal_conductivity, 1);
+	deallocateCacheAlignedArray(prev_enthalpy_particle, 1);
+
+	PelletNodeValues *node_values = allocateCacheAlignedArray<PelletNodeValues>(number_of_nodes);
+
+	timeNodeValuesLoop(node_values, solver);
+
+	double padded_time = timeNodeValuesLoop(node_values, solver);
+
+	deallocateCacheAlignedArray(node_values);
+
+	std::cout << "Arrays, 1 grid point per chunk\t: " << interleaved_time * 1E6 << " us per iteration\n";
+	std::cout << "Arrays, " << nodes_per_line << " grid points per chunk\t: " << blocked_time * 1E6 << " us per iteration\n";
+	std::cout << "Node values, 1 grid point per chunk\t: " << padded_time * 1E6 << " us per iteration\n";
+
+	return 0;
+}
+
+void parseProgramOptions(int argc, char const *argv[])
+{
+	ez::ezOptionParser opt;
+
+	opt.overview	= "Times the parallel loops over grid points writing to arrays, one grid point and one cache line of grid points per thread at a time, and to the padded node values of the pellet.";
+	opt.syntax		= "Node-Loop-Benchmark [OPTIONS]";
+	opt.example		= "OMP_NUM_THREADS=32 Node-Loop-Benchmark -nodes 1001 -iterations 10000 -reacting-nodes 32\n\n";
+
+	setHelpOption(opt);
+	setBenchmarkNodesOption(opt);
+	setBenchmarkIterationsOption(opt);
+	setBenchmarkWorkOption(opt);
+	setBenchmarkReactingNodesOption(opt);
+	setBenchmarkReactingWorkOption(opt);
+
+	opt.parse(argc, argv);
+
+	displayHelpOption(opt);
+
+	number_of_nodes			= getBenchmarkNodesOption(opt, number_of_nodes);
+	number_of_iterations	= getBenchmarkIterationsOption(opt, number_of_iterations);
+
+	work = getBenchmarkWorkOption(opt, work);
+
+	number_of_reacting_nodes	= getBenchmarkReactingNodesOption(opt, number_of_reacting_nodes);
+	reacting_work				= getBenchmarkReactingWorkOption(opt, reacting_work);
+}
\ No newline at end of file
@@ -0,0 +1,390 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include <sys/resource.h>
+
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+#include "pde-problems/Pellet-Flame-Propagation.hpp"
+
+#include "math/Linear-Regression.hpp"
+
+#include "utilities/File-Generator.hpp"
+#include "utilities/Program-Options.hpp"
+
+#define MAX_ITER 1E8
+
+// Temperature in K marking the flame front
+#define FLAME_TEMPERATURE 1000.
+
+#define DEFAULT_DIFFUSIVITY_DIRECTORY "data/core-shell-particle/diffusivity-parameters"
+
+struct SweepCase
+{
+	double phi;
+	double initial_ignition_temperature;
+	double initial_ignition_length_fraction;
+
+	std::string diffusivity_directory;
+};
+
+struct SweepResult
+{
+	real_t flame_speed;
+	real_t simulated_time;
+
+	size_t iterations;
+	bool combustion_complete;
+
+	long runtime;
+
+	// Memory allocated by the pellet of the case, in kB
+	size_t memory;
+
+	// Peak resident set size of the whole process when the case completed, in kB
+	long process_peak_memory;
+};
+
+std::vector<double> phi_list(1, 0.7);
+std::vector<double> initial_ignition_temperature_list(1, 1500.);
+std::vector<double> initial_ignition_length_fraction_list(1, 0.1);
+std::vector<std::string> diffusivity_directory_list(1, DEFAULT_DIFFUSIVITY_DIRECTORY);
+
+std::string cases_file_name = "";
+
+int case_threads = 0;
+int node_threads = 0;
+
+double max_time = 1.0;
+
+// Memory in GB the concurrent cases may allocate together, 0 for no limit
+double memory_budget = 0;
+
+// Particle grid points from which species may be solved concurrently, 0 to never
+int species_tasks_threshold = DEFAULT_SPECIES_TASKS_THRESHOLD;
+
+bool task_pipeline = false;
+
+void parseProgramOptions(int argc, char const *argv[]);
+
+std::vector<SweepCase> getSweepCases();
+
+SweepResult runCase(const SimulationConfig &config, const SweepCase &sweep_case);
+
+int main(int argc, char const *argv[])
+{
+	parseProgramOptions(argc, argv);
+
+	std::vector<SweepCase> cases = getSweepCases();
+
+	// Property data is read once per diffusivity parameter set
+	// and shared by all cases using that set
+	std::map<std::string, SimulationConfig *> configs;
+
+	for (size_t i = 0; i < cases.size(); i++)
+	{
+		SimulationConfig *&config = configs[cases[i].diffusivity_directory];
+
+		if (config == NULL) config = new SimulationConfig(
+			"data/core-shell-particle",
+			"data/pellet",
+			"data/PDE-solver-config",
+			cases[i].diffusivity_directory.c_str()
+		);
+
+		if (cases[i].initial_ignition_temperature < config->diffusivity_model.getCriticalTemperature())
+		{
+			std::cerr << "Ignition Temperature should be greater than " << config->diffusivity_model.getCriticalTemperature();
+			std::cerr << " K for " << cases[i].diffusivity_directory << ". Given " << cases[i].initial_ignition_temperature << " K\n";
+			std::abort();
+		}
+	}
+
+	#ifdef _OPENMP
+		int max_threads = omp_get_max_threads();
+	#else
+		int max_threads = 1;
+	#endif
+
+	// Split the threads between concurrent cases and grid points of each case
+	if (case_threads == 0) case_threads = std::min((int) cases.size(), max_threads);
+	if (node_threads == 0) node_threads = std::max(1, max_threads / case_threads);
+
+	std::cout << "Running " << cases.size() << " cases, " << case_threads << " at a time with ";
+	std::cout << node_threads << " threads each.\n\n";
+
+	// Every case allocates the same, as all share the grid of data/PDE-solver-config
+	PelletMemoryFootprint footprint = PelletFlamePropagation::getMemoryFootprint(configs.begin()->second->m, configs.begin()->second->n);
+
+	std::cout << "Memory Footprint per Case\n";
+	footprint.print(std::cout);
+	std::cout << "\n";
+
+	PelletFlamePropagation::setMemoryBudget(memory_budget * 1E9 / case_threads);
+
+	#ifdef _OPENMP
+		omp_set_dynamic(0);
+		omp_set_max_active_levels(2);
+	#endif
+
+	FileGenerator file_generator;
+
+	std::ofstream summary_file = file_generator.getCSVFile("sweep-summary");
+
+	summary_file << "Case,Particle Volume Fractions,Ignition Temperature (K),Ignition Length Fraction,Diffusivity Parameters,";
+	summary_file << "Flame Speed (m/s),Simulated Time (s),Iterations,Combustion Complete,Runtime (ms),Memory (kB),Process Peak Memory (kB)\n";
+	summary_file.flush();
+
+	#pragma omp parallel for default(shared) schedule(dynamic, 1) num_threads(case_threads)
+
+		for (size_t i = 0; i < cases.size(); i++)
+		{
+			#ifdef _OPENMP
+				// Sets the size of the teams solving the grid points of this case
+				omp_set_num_threads(node_threads);
+			#endif
+
+			SweepResult result = runCase(*configs[cases[i].diffusivity_directory], cases[i]);
+
+			#pragma omp critical (sweep_summary)
+			{
+				summary_file << i << ',' << cases[i].phi << ',' << cases[i].initial_ignition_temperature << ',';
+				summary_file << cases[i].initial_ignition_length_fraction << ',' << cases[i].diffusivity_directory << ',';
+				summary_file << result.flame_speed << ',' << result.simulated_time << ',' << result.iterations << ',';
+				summary_file << result.combustion_complete << ',' << result.runtime << ',';
+				summary_file << result.memory << ',' << result.process_peak_memory << '\n';
+				summary_file.flush();
+
+				std::cout << "Case " << i << " completed : Flame Speed " << result.flame_speed << " m/s\n";
+			}
+		}
+
+	summary_file.close();
+
+	for (std::map<std::string, SimulationConfig *>::iterator it = configs.begin(); it != configs.end(); it++) delete it->second;
+
+	std::cout << "\nSweep complete.\n";
+
+	return 0;
+}
+
+// Returns slope in m/s of the least squares line through the flame front positions
+// lying within [lower_bound, upper_bound] m, or NAN if fewer than two positions do
+real_t calcFlameSpeed(
+	const std::vector<real_t> &time,
+	const std::vector<real_t> &position,
+	real_t lower_bound,
+	real_t upper_bound
+) {
+	LinearRegression regression;
+
+	for (size_t i = 0; i < time.size(); i++)
+	{
+		if (position[i] >= lower_bound && position[i] <= upper_bound) regression.addPoint(time[i], position[i]);
+	}
+
+	return regression.getSlope();
+}
+
+SweepResult runCase(const SimulationConfig &config, const SweepCase &sweep_case)
+{
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+	PelletFlamePropagation combustion_pellet(config, sweep_case.phi);
+
+	combustion_pellet.setSpeciesTasksThreshold(species_tasks_threshold);
+
+	combustion_pellet.initializePellet(
+		sweep_case.initial_ignition_temperature,
+		sweep_case.initial_ignition_length_fraction
+	);
+
+	std::vector<real_t> time, flame_front_position;
+
+	size_t step = 0.001 / combustion_pellet.delta_t;
+
+	size_t i = 0;
+
+	bool combustion_not_complete = true;
+
+	while (i < MAX_ITER && combustion_not_complete && combustion_pellet.getTime() < max_time)
+	{
+		size_t i_step = i + step;
+
+		for (; i < i_step && combustion_not_complete; i++)
+		{
+			if (task_pipeline) combustion_pellet.setUpAndSolveEquationsAsTasks();
+
+			else
+			{
+				combustion_pellet.setUpEquations();
+				combustion_pellet.solveEquations();
+			}
+
+			combustion_not_complete = !combustion_pellet.isCombustionComplete();
+		}
+
+		time.push_back(combustion_pellet.getTime());
+		flame_front_position.push_back(combustion_pellet.getFlameFrontPosition(FLAME_TEMPERATURE));
+	}
+
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	// Fit only the middle of the unignited length, away from
+	// the ignition transient and the far end of the pellet
+	real_t ignition_length	= sweep_case.initial_ignition_length_fraction * combustion_pellet.length;
+	real_t unignited_length	= combustion_pellet.length - ignition_length;
+
+	SweepResult result;
+
+	result.flame_speed = calcFlameSpeed(
+		time,
+		flame_front_position,
+		ignition_length + 0.2 * unignited_length,
+		ignition_length + 0.8 * unignited_length
+	);
+
+	result.simulated_time		= combustion_pellet.getTime();
+	result.iterations			= i;
+	result.combustion_complete	= !combustion_not_complete;
+
+	result.runtime = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+
+	result.memory = combustion_pellet.getMemoryFootprint().getTotal() / 1024;
+
+	// Only ever grows, and includes the memory of cases solved concurrently
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+
+	result.process_peak_memory = usage.ru_maxrss;
+
+	return result;
+}
+
+std::vector<SweepCase> getSweepCases()
+{
+	std::vector<SweepCase> cases;
+
+	if (cases_file_name.empty())
+	{
+		// Cartesian product of the swept values
+		for (size_t i = 0; i < diffusivity_directory_list.size(); i++)
+		for (size_t j = 0; j < phi_list.size(); j++)
+		for (size_t k = 0; k < initial_ignition_temperature_list.size(); k++)
+		for (size_t l = 0; l < initial_ignition_length_fraction_list.size(); l++)
+		{
+			SweepCase sweep_case;
+
+			sweep_case.phi								= phi_list[j];
+			sweep_case.initial_ignition_temperature		= initial_ignition_temperature_list[k];
+			sweep_case.initial_ignition_length_fraction	= initial_ignition_length_fraction_list[l];
+			sweep_case.diffusivity_directory			= diffusivity_directory_list[i];
+
+			cases.push_back(sweep_case);
+		}
+
+		return cases;
+	}
+
+	std::ifstream cases_file(cases_file_name.c_str());
+
+	if (!cases_file.is_open())
+	{
+		std::cerr << "[ERROR] Could not open file - " << cases_file_name << std::endl;
+		std::abort();
+	}
+
+	std::string line;
+
+	// Lines are phi,ignT,ignL[,diffusivity-directory], blank lines and lines starting with # are skipped
+	for (size_t line_number = 1; std::getline(cases_file, line); line_number++)
+	{
+		if (line.empty() || line[0] == '#') continue;
+
+		std::istringstream line_stream(line);
+
+		SweepCase sweep_case;
+		char delimiter[3];
+
+		line_stream >> sweep_case.phi >> delimiter[0];
+		line_stream >> sweep_case.initial_ignition_temperature >> delimiter[1];
+		line_stream >> sweep_case.initial_ignition_length_fraction;
+
+		if (
+			line_stream.fail() || delimiter[0] != ',' || delimiter[1] != ',' ||
+			sweep_case.phi <= 0 || sweep_case.phi >= 1 ||
+			sweep_case.initial_ignition_length_fraction <= 0 || sweep_case.initial_ignition_length_fraction >= 1
+		) {
+			std::cerr << "[ERROR] Invalid case at line " << line_number << " of " << cases_file_name << " - " << line << std::endl;
+			std::abort();
+		}
+
+		if (line_stream >> delimiter[2] && delimiter[2] == ',') line_stream >> sweep_case.diffusivity_directory;
+
+		if (sweep_case.diffusivity_directory.empty()) sweep_case.diffusivity_directory = DEFAULT_DIFFUSIVITY_DIRECTORY;
+
+		cases.push_back(sweep_case);
+	}
+
+	if (cases.empty())
+	{
+		std::cerr << "[ERROR] No cases found in " << cases_file_name << std::endl;
+		std::abort();
+	}
+
+	return cases;
+}
+
+void parseProgramOptions(int argc, char const *argv[])
+{
+	ez::ezOptionParser opt;
+
+	opt.overview	= "Parameter sweep of flame propagation in pellets packed with energetic intermetallic core-shell particles.";
+	opt.syntax		= "Pellet-Flame-Propagation-Sweep [OPTIONS]";
+	opt.example		= "Pellet-Flame-Propagation-Sweep -phi-list 0.5,0.6,0.7 -diffusivity-list data/diffusivity-parameters/Alawieh,data/diffusivity-parameters/Du\n\n";
+
+	setHelpOption(opt);
+	setPhiListOption(opt);
+	setIgnitionTemperatureListOption(opt);
+	setIgnitionLengthListOption(opt);
+	setDiffusivityListOption(opt);
+	setCasesFileOption(opt);
+	setCaseThreadsOption(opt);
+	setNodeThreadsOption(opt);
+	setMaxTimeOption(opt);
+	setMemoryBudgetOption(opt);
+	setSpeciesTasksOption(opt);
+	setTaskPipelineOption(opt);
+
+	opt.parse(argc, argv);
+
+	displayHelpOption(opt);
+
+	phi_list = getPhiListOption(opt, phi_list);
+
+	initial_ignition_temperature_list = getIgnitionTemperatureListOption(opt, initial_ignition_temperature_list);
+	initial_ignition_length_fraction_list = getIgnitionLengthListOption(opt, initial_ignition_length_fraction_list);
+
+	diffusivity_directory_list = getDiffusivityListOption(opt, diffusivity_directory_list);
+
+	cases_file_name = getCasesFileOption(opt, cases_file_name);
+
+	case_threads = getCaseThreadsOption(opt, case_threads);
+	node_threads = getNodeThreadsOption(opt, node_threads);
+
+	max_time = getMaxTimeOption(opt, max_time);
+
+	memory_budget = getMemoryBudgetOption(opt, memory_budget);
+
+	species_tasks_threshold = getSpeciesTasksOption(opt, species_tasks_threshold);
+
+	task_pipeline = getTaskPipelineOption(opt);
+}
\ No newline at end of file
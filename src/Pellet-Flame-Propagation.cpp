@@ -1,12 +1,32 @@
 #include <iostream>
 #include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <thread>
+#include <cmath>
+
+#include <csignal>
+#include <pthread.h>
 
 #include "pde-problems/Core-Shell-Diffusion.hpp"
 #include "pde-problems/Pellet-Flame-Propagation.hpp"
+#include "pde-problems/Flame-Front-Tracker.hpp"
+#include "pde-problems/Steady-Flame-Detector.hpp"
 
 #include "utilities/File-Generator.hpp"
+#include "utilities/Async-Profile-Writer.hpp"
+#include "utilities/Chunked-Frame-File.hpp"
+#include "utilities/Compressed-Frame-File.hpp"
+#include "utilities/Frame-Pyramid.hpp"
+#include "utilities/Profile-Formatter.hpp"
 #include "utilities/Program-Options.hpp"
 #include "utilities/Keyboard-Interrupt.hpp"
+#include "utilities/Phase-Timer.hpp"
+#include "utilities/Trace-Recorder.hpp"
+#include "utilities/Memory-Usage.hpp"
+#include "utilities/Thread-Affinity.hpp"
+#include "utilities/Solver-Metrics.hpp"
 
 #define MAX_ITER 1E8
 
@@ -15,96 +35,560 @@ long double phi = 0.7;
 long double initial_ignition_temperature = 1500;
 long double initial_ignition_length_fraction = 0.1;
 
+std::string output_format = "csv";
+
+int chunk_frames = 1000;
+
+int pyramid_levels = 0;
+
+std::string restart_file_name = "";
+
+// Runtime in s between checkpoints
+double checkpoint_interval = 600;
+
+// Relative change of flame speed below which the flame is steady, 0 to not stop when steady
+double steady_tolerance = 0;
+double steady_window = 0.01;
+double steady_duration = 0.02;
+
+// Events per thread in the timeline, 0 to not record one
+int trace_events = 0;
+
+bool node_costs = false;
+
+// Memory in GB the pellet may allocate, 0 for no limit
+double memory_budget = 0;
+
+bool pin_threads = false;
+
+// Particle grid points from which species may be solved concurrently, 0 to never
+int species_tasks_threshold = DEFAULT_SPECIES_TASKS_THRESHOLD;
+
+bool task_pipeline = false;
+
+bool metrics = false;
+
+// Names of the files of the time spent on each grid point, by NodeCostKind
+const char * const NODE_COST_FILE_NAMES[NUMBER_OF_NODE_COST_KINDS] = {
+	"node-cost-transient-term",
+	"node-cost-particle-update"
+};
+
+// Flame speed fit and steadiness, saved with the pellet in checkpoints
+class FlameState : public RunState
+{
+	private:
+
+		FlameFrontTracker &_flame_front_tracker;
+		SteadyFlameDetector &_steady_flame_detector;
+
+	public:
+
+		FlameState(FlameFrontTracker &flame_front_tracker, SteadyFlameDetector &steady_flame_detector) :
+			_flame_front_tracker(flame_front_tracker),
+			_steady_flame_detector(steady_flame_detector)
+		{ ; }
+
+		void writeState(std::ostream &output_stream) const
+		{
+			_flame_front_tracker.writeState(output_stream);
+			_steady_flame_detector.writeState(output_stream);
+		}
+
+		void readState(std::istream &input_stream)
+		{
+			_flame_front_tracker.readState(input_stream);
+			_steady_flame_detector.readState(input_stream);
+		}
+};
+
 void parseProgramOptions(int argc, char const *argv[]);
 
+void printTemperatureProfile(PelletFlamePropagation &combustion_pellet, AsyncProfileWriter &temperature_writer);
+
+void printPhaseProfile(FileGenerator &file_generator, std::chrono::steady_clock::time_point begin);
+
+void printNodeCosts(NodeCostMap &node_cost_map, std::ofstream *node_cost_files, real_t time);
+
+void publishMetrics(
+	SolverMetricsPublisher &metrics_publisher,
+	PelletFlamePropagation &combustion_pellet,
+	const FlameFrontTracker &flame_front_tracker,
+	size_t iteration,
+	SolverState state
+);
+
+void startSnapshot(
+	const PelletFlamePropagation &combustion_pellet,
+	FileGenerator &file_generator,
+	std::thread &snapshot_thread,
+	size_t snapshot_number
+);
+
 int main(int argc, char const *argv[])
 {
 	parseProgramOptions(argc, argv);
 
-    CoreShellDiffusion::setUpRadiusArray();
+	SimulationConfig config;
+
+	// A restarted pellet keeps the particle volume fractions it was started with
+	if (!restart_file_name.empty()) phi = readPelletCheckpointHeader(restart_file_name.c_str()).particle_volume_fractions;
+
+	PelletFlamePropagation::setMemoryBudget(memory_budget * 1E9);
+
+	// Threads are pinned before the particles they own are first touched
+	if (pin_threads) std::cout << "Pinned " << pinOpenMPThreads() << " threads\n";
+
+	PelletFlamePropagation combustion_pellet(config, phi);
 
-	PelletFlamePropagation combustion_pellet(phi);
+	combustion_pellet.setSpeciesTasksThreshold(species_tasks_threshold);
+
+	std::cout << "\nMemory Footprint\n";
+	combustion_pellet.getMemoryFootprint().print(std::cout);
+	std::cout << "\n";
 
     combustion_pellet.initializePellet(
 		initial_ignition_temperature,
 		initial_ignition_length_fraction
 	);
 
+	// Flame speed is fit to the front positions of every iteration, leaving
+	// out the ends of the unignited length where the flame is not steady
+	real_t ignition_length	= initial_ignition_length_fraction * combustion_pellet.length;
+	real_t unignited_length	= combustion_pellet.length - ignition_length;
+
+	FlameFrontTracker flame_front_tracker(
+		ignition_length + 0.1 * unignited_length,
+		combustion_pellet.length - 0.1 * unignited_length,
+		1000.,
+		steady_tolerance > 0 ? steady_window : 0
+	);
+
+	SteadyFlameDetector steady_flame_detector(steady_tolerance, steady_window, steady_duration);
+
+	FlameState flame_state(flame_front_tracker, steady_flame_detector);
+
+	size_t i = 0;
+
+	if (!restart_file_name.empty()) i = combustion_pellet.readCheckpoint(restart_file_name.c_str(), &flame_state);
+
+	const size_t first_iteration = i;
+
     FileGenerator file_generator;
 
 	std::ofstream program_input_file = file_generator.getTXTFile("program-input");
 
 	program_input_file << "Pellet\n\nParticle Volume Fractions:\t" << phi << "\n";
-	program_input_file << "Density:\t" << combustion_pellet.overall_particle_density + combustion_pellet.interstitial_volume_fractions * PackedPellet::interstitial_gas.getDensity(298.15) << " kg/m3\n\n";
+	program_input_file << "Density:\t" << combustion_pellet.overall_particle_density + combustion_pellet.interstitial_volume_fractions * combustion_pellet.interstitial_gas.getDensity(298.15) << " kg/m3\n\n";
 	program_input_file << "Initial Ignition Temperature:\t" << initial_ignition_temperature << " K\n";
-	program_input_file << "Initial Ignition Length:\t" << initial_ignition_length_fraction * PackedPellet::length << " m\n";
+	program_input_file << "Initial Ignition Length:\t" << initial_ignition_length_fraction * combustion_pellet.length << " m\n";
 	program_input_file << "Initial Ignition Length Fraction:\t" << initial_ignition_length_fraction << "\n";
 
+	program_input_file << "\nMemory Footprint\n";
+	combustion_pellet.getMemoryFootprint().print(program_input_file);
+
+	if (!restart_file_name.empty())
+	{
+		program_input_file << "\nRestarted from Checkpoint:\t" << restart_file_name << "\n";
+		program_input_file << "Iterations Completed:\t" << first_iteration << "\n";
+		program_input_file << "Time:\t" << combustion_pellet.getTime() << " s\n";
+	}
+
 	program_input_file.close();
 
-    std::ofstream temperature_file = file_generator.getCSVFile("temperature");
+	std::ofstream temperature_file;
 
-    std::cout << "Initialized Pellet. Starting iterations.\nPress Ctrl+C to stop...\n\n";
+	ProfileSink *temperature_sink;
 
-    setUpKeyboardInterrupt();
+	if (output_format == "binary")
+	{
+		temperature_file = file_generator.getFrameFile("temperature");
 
-	size_t i = 0;
-    
-	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		std::vector<real_t> grid_points(combustion_pellet.m);
+		combustion_pellet.getGridPoints(grid_points.data());
+
+		temperature_sink = new FrameWriter(temperature_file, combustion_pellet.m, grid_points.data(), "temperature", "K", "m");
+	}
+
+	else if (output_format == "chunked")
+	{
+		std::vector<real_t> grid_points(combustion_pellet.m);
+		combustion_pellet.getGridPoints(grid_points.data());
+
+		temperature_sink = new ChunkedFrameWriter(
+			file_generator.getFolderName() + "/temperature.chunks",
+			combustion_pellet.m, grid_points.data(), "temperature", "K", "m", chunk_frames
+		);
+	}
+
+	else if (output_format == "compressed")
+	{
+		temperature_file = file_generator.getCompressedFrameFile("temperature");
+
+		std::vector<real_t> grid_points(combustion_pellet.m);
+		combustion_pellet.getGridPoints(grid_points.data());
+
+		temperature_sink = new CompressedFrameWriter(temperature_file, combustion_pellet.m, grid_points.data(), "temperature", "K", "m");
+	}
+
+	else
+	{
+		temperature_file = file_generator.getCSVFile("temperature");
 
-    try
-    {
 		combustion_pellet.printGridPoints(temperature_file, ',');
 
-		size_t step = 0.001 / PelletFlamePropagation::delta_t;
+		temperature_sink = new CSVProfileSink(temperature_file, ',');
+	}
+
+	// Decimated levels are written alongside the full resolution profiles
+	PyramidProfileSink *temperature_pyramid = NULL;
+
+	if (pyramid_levels > 0)
+	{
+		std::vector<real_t> grid_points(combustion_pellet.m);
+		combustion_pellet.getGridPoints(grid_points.data());
 
-		bool combustion_not_complete = true;
+		temperature_pyramid = new PyramidProfileSink(
+			*temperature_sink, file_generator.getFolderName() + "/temperature.pyramid", pyramid_levels,
+			combustion_pellet.m, grid_points.data(), "temperature", "K", "m"
+		);
+	}
 
-		for (; i < MAX_ITER && combustion_not_complete;)
+	// Profiles are formatted and written on a separate thread
+	AsyncProfileWriter *temperature_writer = new AsyncProfileWriter(
+		temperature_pyramid != NULL ? *temperature_pyramid : *temperature_sink,
+		combustion_pellet.m
+	);
+
+	bool flame_steady = false;
+
+	std::ofstream flame_front_file = file_generator.getCSVFile("flame-front");
+
+	flame_front_tracker.printHeader(flame_front_file);
+
+	// Time spent on each grid point in each output interval
+	NodeCostMap *node_cost_map = NULL;
+
+	std::ofstream node_cost_files[NUMBER_OF_NODE_COST_KINDS];
+
+	if (node_costs)
+	{
+		node_cost_map = new NodeCostMap(combustion_pellet.m);
+
+		for (int kind = 0; kind < NUMBER_OF_NODE_COST_KINDS; kind++)
 		{
-			size_t i_step = i + step;
+			node_cost_files[kind] = file_generator.getCSVFile(NODE_COST_FILE_NAMES[kind]);
+
+			combustion_pellet.printGridPoints(node_cost_files[kind], ',');
+		}
+
+		combustion_pellet.setNodeCostMap(node_cost_map);
+	}
 
-			for (;i < i_step && combustion_not_complete; i++)
+	// Complete state of the pellet, to resume the simulation with -restart
+	std::string checkpoint_file_name = file_generator.getFolderName() + "/checkpoint.bin";
+
+	// Progress read by Pellet-Metrics-Monitor while the simulation runs
+	SolverMetricsPublisher *metrics_publisher = NULL;
+
+	if (metrics)
+	{
+		metrics_publisher = new SolverMetricsPublisher(file_generator.getFolderName() + "/metrics.bin");
+
+		publishMetrics(*metrics_publisher, combustion_pellet, flame_front_tracker, i, SOLVER_RUNNING);
+	}
+
+	std::cout << "Initialized Pellet. Starting iterations.\nPress Ctrl+C to stop...\n\n";
+
+	// Signals are only recorded, the pellet is saved at the end of the iteration
+	setUpInterruptFlag();
+
+	// kill -USR1 <pid> writes a snapshot at the end of the iteration
+	// on a separate thread, without stopping the simulation
+	setUpSnapshotRequest();
+
+	std::thread snapshot_thread;
+	size_t number_of_snapshots = 0;
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point last_checkpoint = begin;
+
+	size_t step = 0.001 / combustion_pellet.delta_t;
+
+	bool combustion_not_complete = true;
+
+	for (; i < MAX_ITER && combustion_not_complete && !flame_steady;)
+	{
+		// Profiles are written at multiples of step iterations, also after a restart
+		size_t i_step = (i / step + 1) * step;
+
+		for (;i < i_step && combustion_not_complete && getInterruptSignal() == 0; i++)
+		{
+			if (task_pipeline) combustion_pellet.setUpAndSolveEquationsAsTasks();
+
+			else
 			{
 				combustion_pellet.setUpEquations();
 				combustion_pellet.solveEquations();
-
-				combustion_not_complete = !combustion_pellet.isCombustionComplete();
 			}
 
-			combustion_pellet.printTemperatureProfile(temperature_file, ',');
-			std::cout << "Iterations Completed : " << i << "\n";
+			combustion_not_complete = !combustion_pellet.isCombustionComplete();
+
+			flame_front_tracker.track(combustion_pellet);
+
+			if (metrics_publisher != NULL) publishMetrics(*metrics_publisher, combustion_pellet, flame_front_tracker, i + 1, SOLVER_RUNNING);
+
+			if (isSnapshotRequested()) startSnapshot(combustion_pellet, file_generator, snapshot_thread, ++number_of_snapshots);
+		}
+
+		{
+			ScopedPhaseTimer timer(PHASE_OUTPUT);
+
+			printTemperatureProfile(combustion_pellet, *temperature_writer);
+			flame_front_tracker.printState(flame_front_file);
+
+			if (node_cost_map != NULL) printNodeCosts(*node_cost_map, node_cost_files, combustion_pellet.getTime());
+		}
+
+		std::cout << "Iterations Completed : " << i;
+
+		if (!std::isnan(flame_front_tracker.getFlameSpeed()))
+		{
+			std::cout << "\tFlame Speed : " << flame_front_tracker.getFlameSpeed() * 1000;
+			std::cout << " (fit standard error " << flame_front_tracker.getFlameSpeedStandardError() * 1000 << " mm/s)";
 		}
 
-    	std::cout << "\nPellet combustion complete.\n";
-    }
+		std::cout << "\n";
+
+		if (getInterruptSignal() != 0) break;
+
+		if (steady_tolerance > 0) flame_steady = steady_flame_detector.update(combustion_pellet.getTime(), flame_front_tracker.getLocalFlameSpeed());
+
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+		if (checkpoint_interval > 0 && std::chrono::duration<double>(now - last_checkpoint).count() >= checkpoint_interval)
+		{
+			combustion_pellet.writeCheckpoint(checkpoint_file_name.c_str(), i, &flame_state);
+			last_checkpoint = now;
+		}
+	}
+
+	if (snapshot_thread.joinable()) snapshot_thread.join();
+
+	if (getInterruptSignal() != 0)
+	{
+		std::cout << "\nCaught signal " << getInterruptSignal() << std::endl;
+
+		combustion_pellet.writeCheckpoint(checkpoint_file_name.c_str(), i, &flame_state);
+
+		std::cout << "Saved checkpoint " << checkpoint_file_name << std::endl;
+
+		if (metrics_publisher != NULL) publishMetrics(*metrics_publisher, combustion_pellet, flame_front_tracker, i, SOLVER_INTERRUPTED);
+
+		delete metrics_publisher;
+
+		flame_front_file.close();
+
+		delete node_cost_map;
+
+		delete temperature_writer;
+		delete temperature_pyramid;
+		delete temperature_sink;
+		temperature_file.close();
+
+		printPhaseProfile(file_generator, begin);
+
+		return 1;
+	}
 
-    catch (InterruptException& e)
-    {
-        std::cout << "\nCaught signal " << e.S << std::endl;
+	if (flame_steady)
+	{
+		std::cout << "\nFlame speed is steady.\n";
+		std::cout << "Converged Flame Speed : " << steady_flame_detector.getSpeed() * 1000 << " mm/s\n";
+	}
 
-        combustion_pellet.printTemperatureProfile(temperature_file, ',');
-        temperature_file.close();
+	else std::cout << "\nPellet combustion complete.\n";
 
-        return 1;
-    }
+	std::cout << "Flame Speed : " << flame_front_tracker.getFlameSpeed() * 1000;
+	std::cout << " (fit standard error " << flame_front_tracker.getFlameSpeedStandardError() * 1000 << " mm/s)\n";
+
+	flame_front_file.close();
+
+	delete node_cost_map;
+
+	if (metrics_publisher != NULL) publishMetrics(*metrics_publisher, combustion_pellet, flame_front_tracker, i, SOLVER_COMPLETE);
+
+	delete metrics_publisher;
 
 	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
 
 	std::ofstream time_file = file_generator.getTXTFile("runtime");
 
 	time_file << "Time difference\t= " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " [ms]" << std::endl;
-	time_file << "Time per iteration\t= " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() / i << " [ms]" << std::endl;
+	time_file << "Time per iteration\t= " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() / std::max(i - first_iteration, (size_t) 1) << " [ms]" << std::endl;
+	time_file << "Output stalls\t= " << temperature_writer->getNumberOfStalls() << std::endl;
+	time_file << "Peak resident memory\t= " << getPeakResidentSetSize() / 1048576.0 << " [MB]" << std::endl;
+	time_file << "Iterations with concurrent species\t= " << combustion_pellet.getSpeciesTasksIterations() << std::endl;
+
+	if (flame_steady) time_file << "Converged flame speed\t= " << steady_flame_detector.getSpeed() << " [m/s]" << std::endl;
     time_file.close();
 
-    combustion_pellet.printTemperatureProfile(temperature_file, ',');
+    printTemperatureProfile(combustion_pellet, *temperature_writer);
+
+	delete temperature_writer;
+	delete temperature_pyramid;
+	delete temperature_sink;
     temperature_file.close();
 
-	CoreShellDiffusion::deallocateRadiusArray();
+	printPhaseProfile(file_generator, begin);
 
     return 0;
 }
 
+// Publishes progress after iteration # iteration
+void publishMetrics(
+	SolverMetricsPublisher &metrics_publisher,
+	PelletFlamePropagation &combustion_pellet,
+	const FlameFrontTracker &flame_front_tracker,
+	size_t iteration,
+	SolverState state
+) {
+	SolverMetricsValues values;
+
+	values.iteration		= iteration;
+	values.reacting_nodes	= combustion_pellet.getNumberOfReactingNodes();
+	values.state			= state;
+	values.reserved			= 0;
+
+	values.time					= combustion_pellet.getTime();
+	values.flame_front_position	= combustion_pellet.getFlameFrontPosition(flame_front_tracker.flame_temperature);
+	values.flame_speed			= flame_front_tracker.getFlameSpeed();
+	values.max_temperature		= combustion_pellet.getMaxTemperature();
+
+	metrics_publisher.publish(values);
+}
+
+// Writes the time spent in each phase and the timeline, once the writer thread has stopped
+void printPhaseProfile(FileGenerator &file_generator, std::chrono::steady_clock::time_point begin)
+{
+	if (isTracingEnabled())
+	{
+		std::ofstream trace_file(file_generator.getFolderName() + "/trace.json");
+		printChromeTrace(trace_file);
+		trace_file.close();
+
+		if (getNumberOfOverwrittenTraceEvents() > 0) std::cout << "Trace holds the last events of each thread, overwrote " << getNumberOfOverwrittenTraceEvents() << " earlier events\n";
+	}
+
+	if (!arePhaseTimersEnabled()) return;
+
+	double wall_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	std::ofstream json_file(file_generator.getFolderName() + "/profile.json");
+	printPhaseProfileJSON(json_file, wall_time);
+	json_file.close();
+
+	std::ofstream csv_file = file_generator.getCSVFile("profile");
+	printPhaseProfileCSV(csv_file);
+	csv_file.close();
+}
+
+// Writes the time in s spent on each grid point since the last call as rows at time
+void printNodeCosts(NodeCostMap &node_cost_map, std::ofstream *node_cost_files, real_t time)
+{
+	std::vector<real_t> costs(node_cost_map.number_of_nodes);
+
+	for (int kind = 0; kind < NUMBER_OF_NODE_COST_KINDS; kind++)
+	{
+		node_cost_map.copyCosts((NodeCostKind) kind, costs.data());
+
+		CSVProfileSink(node_cost_files[kind], ',').writeProfile(time, costs.data(), costs.size());
+	}
+
+	node_cost_map.reset();
+}
+
+// Snapshots the temperature profile for the writer thread
+void printTemperatureProfile(PelletFlamePropagation &combustion_pellet, AsyncProfileWriter &temperature_writer)
+{
+	combustion_pellet.copyTemperatureProfile(temperature_writer.acquireBuffer());
+
+	temperature_writer.submitBuffer(combustion_pellet.getTime());
+}
+
+// Writes the snapshot to files in folder and deletes it
+void writeSnapshot(PelletSnapshot *snapshot, FileGenerator *file_generator, std::string folder)
+{
+	std::ofstream summary_file = file_generator->getTXTFile("snapshot", folder);
+
+	summary_file << "Time:\t" << snapshot->time << " s\n";
+	summary_file << "Flame Front Position:\t" << snapshot->flame_front_position << " m\n";
+	summary_file << "Reaction Zone Begin:\t" << snapshot->reaction_zone_begin << " m\n";
+	summary_file << "Reaction Zone End:\t" << snapshot->reaction_zone_end << " m\n";
+	summary_file << "Particles:\t";
+
+	for (size_t k = 0; k < snapshot->particle_indices.size(); k++) summary_file << snapshot->particle_indices[k] << '\t';
+
+	summary_file << "\n";
+	summary_file.close();
+
+	std::ofstream temperature_file = file_generator->getCSVFile("temperature", folder);
+
+	printProfile(temperature_file, NAN, snapshot->x_grid_points.data(), snapshot->x_grid_points.size());
+	printProfile(temperature_file, snapshot->time, snapshot->temperature.data(), snapshot->temperature.size());
+
+	temperature_file.close();
+
+	const size_t n = snapshot->r_grid_points.size();
+
+	for (size_t k = 0; k < snapshot->particle_indices.size(); k++)
+	{
+		std::string particle_name = "particle-" + std::to_string(snapshot->particle_indices[k]);
+
+		std::ofstream concentration_file = file_generator->getCSVFile(particle_name + "-concentration", folder);
+
+		printProfile(concentration_file, NAN, snapshot->r_grid_points.data(), n);
+		printProfile(concentration_file, snapshot->time, snapshot->concentration_A.data() + k * n, n);
+		printProfile(concentration_file, snapshot->time, snapshot->concentration_B.data() + k * n, n);
+
+		concentration_file.close();
+	}
+
+	delete snapshot;
+}
+
+// Copies the state of the pellet and writes it on snapshot_thread,
+// after the previous snapshot has been written
+void startSnapshot(
+	const PelletFlamePropagation &combustion_pellet,
+	FileGenerator &file_generator,
+	std::thread &snapshot_thread,
+	size_t snapshot_number
+) {
+	if (snapshot_thread.joinable()) snapshot_thread.join();
+
+	PelletSnapshot *snapshot = new PelletSnapshot;
+
+	combustion_pellet.takeSnapshot(*snapshot);
+
+	std::cout << "Writing snapshot # " << snapshot_number << " at " << snapshot->time << " s\n";
+
+	// Signals are handled by the simulation thread only
+	sigset_t all_signals, previous_signals;
+	sigfillset(&all_signals);
+
+	pthread_sigmask(SIG_BLOCK, &all_signals, &previous_signals);
+
+	{
+		// The snapshot thread must not share the CPU of pinned OpenMP thread # 0
+		UnpinnedAffinityScope unpinned_affinity;
+
+		snapshot_thread = std::thread(writeSnapshot, snapshot, &file_generator, "snapshot-" + std::to_string(snapshot_number));
+	}
+
+	pthread_sigmask(SIG_SETMASK, &previous_signals, NULL);
+}
+
 void parseProgramOptions(int argc, char const *argv[])
 {
 	ez::ezOptionParser opt;
@@ -118,6 +602,25 @@ void parseProgramOptions(int argc, char const *argv[])
 	setPhiOption(opt);
 	setIgnitionTemperatureOption(opt);
 	setIgnitionLengthOption(opt);
+	setOutputFormatOption(opt);
+	setChunkFramesOption(opt);
+	setPyramidLevelsOption(opt);
+	setSignificantDigitsOption(opt);
+	setRestartFileOption(opt);
+	setCheckpointIntervalOption(opt);
+	setSteadyToleranceOption(opt);
+	setSteadyWindowOption(opt);
+	setSteadyDurationOption(opt);
+	setProfileOption(opt);
+	setPerfCountersOption(opt);
+	setPerfRawEventOption(opt);
+	setTraceOption(opt);
+	setNodeCostsOption(opt);
+	setMemoryBudgetOption(opt);
+	setPinThreadsOption(opt);
+	setSpeciesTasksOption(opt);
+	setTaskPipelineOption(opt);
+	setMetricsOption(opt);
 
 	opt.parse(argc, argv);
 
@@ -127,4 +630,45 @@ void parseProgramOptions(int argc, char const *argv[])
 
 	initial_ignition_temperature = getIgnitionTemperatureOption(opt, initial_ignition_temperature);
 	initial_ignition_length_fraction = getIgnitionLengthOption(opt, initial_ignition_length_fraction);
+
+	output_format = getOutputFormatOption(opt, output_format);
+
+	chunk_frames = getChunkFramesOption(opt, chunk_frames);
+
+	pyramid_levels = getPyramidLevelsOption(opt, pyramid_levels);
+
+	setSignificantDigits(getSignificantDigitsOption(opt, DEFAULT_SIGNIFICANT_DIGITS));
+
+	restart_file_name = getRestartFileOption(opt, restart_file_name);
+
+	checkpoint_interval = getCheckpointIntervalOption(opt, checkpoint_interval);
+
+	steady_tolerance	= getSteadyToleranceOption(opt, steady_tolerance);
+	steady_window		= getSteadyWindowOption(opt, steady_window);
+	steady_duration		= getSteadyDurationOption(opt, steady_duration);
+
+	if (getProfileOption(opt)) enablePhaseTimers();
+
+	// Counters are only read by the phase timers
+	if (getPerfCountersOption(opt))
+	{
+		enablePhaseTimers();
+		enablePerfCounters(getPerfRawEventOption(opt, 0));
+	}
+
+	trace_events = getTraceOption(opt, trace_events);
+
+	if (trace_events > 0) enableTracing(trace_events);
+
+	node_costs = getNodeCostsOption(opt);
+
+	memory_budget = getMemoryBudgetOption(opt, memory_budget);
+
+	pin_threads = getPinThreadsOption(opt);
+
+	species_tasks_threshold = getSpeciesTasksOption(opt, species_tasks_threshold);
+
+	task_pipeline = getTaskPipelineOption(opt);
+
+	metrics = getMetricsOption(opt);
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+
+#include <signal.h>
+#include <sys/stat.h>
+
+#include "utilities/Program-Options.hpp"
+#include "utilities/Solver-Metrics.hpp"
+
+// Metrics files, or solution folders holding a metrics.bin
+std::vector<std::string> metrics_file_names;
+
+// Seconds between displays, 0 to display once
+int watch_interval = 0;
+
+void parseProgramOptions(int argc, char const *argv[]);
+
+// Returns state of the run, a solver still marked running whose process
+// has exited was killed without a chance to publish its final state
+std::string getRunState(const SolverMetricsReader &metrics_reader, const SolverMetricsValues &values)
+{
+	if (
+		values.state == SOLVER_RUNNING &&
+		kill(metrics_reader.getPID(), 0) != 0 &&
+		errno == ESRCH
+	) return "killed";
+
+	return getSolverStateName((SolverState) values.state);
+}
+
+// Writes one tab separated row per run, parsed by dashboards
+void displayMetrics()
+{
+	double now = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	std::cout << "file\tpid\tstate\titeration\ttime [s]\trate [1/s]\treacting nodes\tfront [m]\tspeed [mm/s]\tmax temperature [K]\trss [MB]\tage [s]";
+
+	for (int phase = 0; phase < NUMBER_OF_SOLVER_PHASES; phase++) std::cout << '\t' << getSolverPhaseName((SolverPhase) phase) << " [s]";
+
+	std::cout << '\n';
+
+	for (size_t file = 0; file < metrics_file_names.size(); file++)
+	{
+		// Files are mapped afresh, a restarted run replaces its file
+		SolverMetricsReader metrics_reader(metrics_file_names[file]);
+
+		if (!metrics_reader.isOpen()) continue;
+
+		SolverMetricsValues values;
+
+		if (!metrics_reader.read(values))
+		{
+			std::cerr << "[WARNING] Could not read consistent metrics - " << metrics_file_names[file] << std::endl;
+			continue;
+		}
+
+		std::cout << metrics_file_names[file] << '\t';
+		std::cout << metrics_reader.getPID() << '\t';
+		std::cout << getRunState(metrics_reader, values) << '\t';
+		std::cout << values.iteration << '\t';
+		std::cout << values.time << '\t';
+		std::cout << values.step_rate << '\t';
+		std::cout << values.reacting_nodes << '\t';
+		std::cout << values.flame_front_position << '\t';
+		std::cout << values.flame_speed * 1000 << '\t';
+		std::cout << values.max_temperature << '\t';
+		std::cout << values.rss / 1048576.0 << '\t';
+		std::cout << now - values.update_time;
+
+		for (int phase = 0; phase < NUMBER_OF_SOLVER_PHASES; phase++) std::cout << '\t' << values.phase_times[phase];
+
+		std::cout << '\n';
+	}
+
+	std::cout << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+	parseProgramOptions(argc, argv);
+
+	std::cout << std::setprecision(6);
+
+	displayMetrics();
+
+	while (watch_interval > 0)
+	{
+		std::this_thread::sleep_for(std::chrono::seconds(watch_interval));
+
+		displayMetrics();
+	}
+
+	return 0;
+}
+
+void parseProgramOptions(int argc, char const *argv[])
+{
+	ez::ezOptionParser opt;
+
+	opt.overview	= "Displays the progress of running solvers published with -metrics, without stopping or slowing them.";
+	opt.syntax		= "Pellet-Metrics-Monitor [OPTIONS] FILES";
+	opt.example		= "Pellet-Metrics-Monitor -watch 5 solutions/*\n\n";
+
+	setHelpOption(opt);
+	setWatchOption(opt);
+
+	opt.parse(argc, argv);
+
+	displayHelpOption(opt);
+
+	watch_interval = getWatchOption(opt, watch_interval);
+
+	for (size_t arg = 0; arg < opt.lastArgs.size(); arg++)
+	{
+		std::string file_name = *opt.lastArgs[arg];
+
+		struct stat file_status;
+
+		if (stat(file_name.c_str(), &file_status) == 0 && S_ISDIR(file_status.st_mode)) file_name += "/metrics.bin";
+
+		metrics_file_names.push_back(file_name);
+	}
+
+	if (metrics_file_names.empty())
+	{
+		std::cerr << "At least one metrics file or solution folder should be given.\n";
+		std::abort();
+	}
+}
\ No newline at end of file
@@ -12,6 +12,11 @@ LUSolver::~LUSolver()
 	delete [] _b;
 }
 
+size_t LUSolver::getAllocatedBytes(unsigned int n)
+{
+	return TridiagonalMatrix::getAllocatedBytes(n) + n * sizeof(real_t);
+}
+
 void LUSolver::printMatrixEquation()
 {
 	std::cout << "Matrix Eqn A.x = b" << std::endl;
@@ -12,6 +12,11 @@ TridiagonalMatrix::~TridiagonalMatrix()
 	delete [] _array;
 }
 
+size_t TridiagonalMatrix::getAllocatedBytes(unsigned int n)
+{
+	return (3*n - 2) * sizeof(real_t);
+}
+
 void TridiagonalMatrix::printMatrix()
 {
 	unsigned int i, j;
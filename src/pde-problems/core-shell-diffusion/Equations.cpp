@@ -34,9 +34,9 @@ void CoreShellDiffusion::updateMassFractions()
 		m_AB += m_AB_i * radial_coordinate_sqr[i];
 	}
 	
-	m_A  *= CoreShellParticle::core_species.molar_mass;
-	m_B  *= CoreShellParticle::shell_species.molar_mass;
-	m_AB *= CoreShellParticle::product_species.molar_mass;
+	m_A  *= config.core_species.molar_mass;
+	m_B  *= config.shell_species.molar_mass;
+	m_AB *= config.product_species.molar_mass;
 	
 	real_t sum = m_A + m_B + m_AB;
 	
@@ -45,12 +45,17 @@ void CoreShellDiffusion::updateMassFractions()
 	CoreShellParticle::_mass_fraction_product_material = m_AB / sum;
 }
 
-void CoreShellDiffusion::setUpEquations(real_t T, CoreShellDiffusion &diffusion_problem)
-{
-	static const real_t one_over_delta_t = 1 / delta_t;
-	static const real_t half_over_delta_r_sqr = 0.5 / std::pow(delta_r, 2);
+// Sets up the equations of a single species in solver, evolving
+// concentration, the profile of the species at the previous step
+void CoreShellDiffusion::setUpSpeciesEquations(
+	LUSolver &solver,
+	const real_t *concentration,
+	real_t diffusivity
+) {
+	const real_t one_over_delta_t = 1 / delta_t;
+	const real_t half_over_delta_r_sqr = 0.5 / std::pow(delta_r, 2);
 
-	real_t coefficient1 = CoreShellParticle::diffusivity_model.getDiffusivity(T) * half_over_delta_r_sqr;
+	real_t coefficient1 = diffusivity * half_over_delta_r_sqr;
 
 	real_t coefficient2 = coefficient1 + one_over_delta_t;
 	real_t coefficient3 = coefficient1 - one_over_delta_t;
@@ -58,37 +63,33 @@ void CoreShellDiffusion::setUpEquations(real_t T, CoreShellDiffusion &diffusion_
 	real_t coefficient4;
 
 	// Set zero flux boundary condition at grid point # 0
-	_solver_A.setEquationFirstRow(-1, 1, 0);
-	_solver_B.setEquationFirstRow(-1, 1, 0);
+	solver.setEquationFirstRow(-1, 1, 0);
 
 	for (size_t i = 1; i < n - 1; i++)
 	{
 		coefficient4 = coefficient1 * radial_coordinate_sqr_ratio[i];
 
-		_solver_A.setEquationSerially(
+		solver.setEquationSerially(
 			i, 
 			- coefficient4, 
 			coefficient2 + coefficient4, 
 			- coefficient1, 
-			coefficient4 * diffusion_problem._concentration_array_A[i+1]
-			- (coefficient3 + coefficient4) * diffusion_problem._concentration_array_A[i]
-			+ coefficient1 * diffusion_problem._concentration_array_A[i-1]
-		);
-
-		_solver_B.setEquationSerially(
-			i, 
-			- coefficient4,
-			coefficient2 + coefficient4,
-			- coefficient1,
-			coefficient4 * diffusion_problem._concentration_array_B[i+1]
-			- (coefficient3 + coefficient4) * diffusion_problem._concentration_array_B[i]
-			+ coefficient1 * diffusion_problem._concentration_array_B[i-1]
+			coefficient4 * concentration[i+1]
+			- (coefficient3 + coefficient4) * concentration[i]
+			+ coefficient1 * concentration[i-1]
 		);
 	}
 
 	// Set zero flux boundary condition at grid point # N
-	_solver_A.setEquationLastRowSerially(1,-1, 0);
-	_solver_B.setEquationLastRowSerially(1,-1, 0);
+	solver.setEquationLastRowSerially(1,-1, 0);
+}
+
+void CoreShellDiffusion::setUpEquations(real_t T, CoreShellDiffusion &diffusion_problem)
+{
+	real_t diffusivity = config.diffusivity_model.getDiffusivity(T);
+
+	setUpSpeciesEquations(_solver_A, diffusion_problem._concentration_array_A, diffusivity);
+	setUpSpeciesEquations(_solver_B, diffusion_problem._concentration_array_B, diffusivity);
 }
 
 void CoreShellDiffusion::solveEquations()
@@ -99,6 +100,27 @@ void CoreShellDiffusion::solveEquations()
 	updateMassFractions();
 }
 
+void CoreShellDiffusion::evolveSpeciesConcurrently(real_t T, CoreShellDiffusion &diffusion_problem)
+{
+	real_t diffusivity = config.diffusivity_model.getDiffusivity(T);
+
+	// Species B may be picked up by any idle thread of the team
+	#pragma omp task default(shared)
+	{
+		setUpSpeciesEquations(_solver_B, diffusion_problem._concentration_array_B, diffusivity);
+
+		_solver_B.getSolutionSerially(_concentration_array_B);
+	}
+
+	setUpSpeciesEquations(_solver_A, diffusion_problem._concentration_array_A, diffusivity);
+
+	_solver_A.getSolutionSerially(_concentration_array_A);
+
+	#pragma omp taskwait
+
+	updateMassFractions();
+}
+
 real_t CoreShellDiffusion::getAtomMassA() const
 {
 	real_t sum = 0.5 * _concentration_array_A[n-1] * radial_coordinate_sqr[n - 1];
@@ -108,7 +130,7 @@ real_t CoreShellDiffusion::getAtomMassA() const
 		sum += _concentration_array_A[i] * radial_coordinate_sqr[i];
 	}
 
-	return 4.0 * M_PI * CoreShellParticle::core_species.molar_mass * delta_r * sum;
+	return 4.0 * M_PI * config.core_species.molar_mass * delta_r * sum;
 }
 
 real_t CoreShellDiffusion::getAtomMassB() const
@@ -120,5 +142,5 @@ real_t CoreShellDiffusion::getAtomMassB() const
 		sum += _concentration_array_B[i] * radial_coordinate_sqr[i];
 	}
 	
-	return 4.0 * M_PI * CoreShellParticle::shell_species.molar_mass * delta_r * sum;
+	return 4.0 * M_PI * config.shell_species.molar_mass * delta_r * sum;
 }
@@ -1,43 +1,25 @@
 #include "pde-problems/Core-Shell-Diffusion.hpp"
 
-#include "utilities/Read-Data.hpp"
-
 #include <cmath>	// pow
 #include <cstring>	// memcpy
+#include <vector>
 
-const real_t CoreShellDiffusion::delta_t = readScalarData<real_t>("data/PDE-solver-config", "delta_t.txt");
-
-const size_t CoreShellDiffusion::n		 = readScalarData<size_t>("data/PDE-solver-config", "number-of-grid-points-particle.txt");
-const real_t CoreShellDiffusion::delta_r = readScalarData<real_t>("data/core-shell-particle", "overall-radius.txt") / ((real_t) CoreShellDiffusion::n - 1);
-
-real_t * CoreShellDiffusion::radial_coordinate_sqr;
-real_t * CoreShellDiffusion::radial_coordinate_sqr_ratio;
+#include "utilities/Profile-Formatter.hpp"
 
-inline real_t CoreShellDiffusion::getRadialCoordinate(size_t i)
+inline real_t CoreShellDiffusion::getRadialCoordinate(size_t i) const
 {
 	return delta_r * (real_t) i;
 }
 
-void CoreShellDiffusion::setUpRadiusArray()
-{
-	radial_coordinate_sqr		= new real_t[n];
-	radial_coordinate_sqr_ratio	= new real_t[n];
-
-	for (size_t i = 0; i < n; i++)		radial_coordinate_sqr[i] = std::pow(getRadialCoordinate(i), 2);
-
-	for (size_t i = 1; i < n-1; i++)	radial_coordinate_sqr_ratio[i] = radial_coordinate_sqr[i+1] / radial_coordinate_sqr[i];
-}
-
-void CoreShellDiffusion::deallocateRadiusArray()
-{
-	delete [] radial_coordinate_sqr;
-	delete [] radial_coordinate_sqr_ratio;
-}
-
-CoreShellDiffusion::CoreShellDiffusion() : 
-	CoreShellParticle(),
-	_solver_A(n),
-	_solver_B(n)
+CoreShellDiffusion::CoreShellDiffusion(const SimulationConfig &config) : 
+	CoreShellParticle(config),
+	_solver_A(config.n),
+	_solver_B(config.n),
+	radial_coordinate_sqr(config.getRadialCoordinateSqr()),
+	radial_coordinate_sqr_ratio(config.getRadialCoordinateSqrRatio()),
+	delta_t(config.delta_t),
+	n(config.n),
+	delta_r(config.delta_r)
 {
 	// Allocate memory for concentration profiles
 	_concentration_array_A = new real_t[n];
@@ -57,16 +39,16 @@ void CoreShellDiffusion::initializeParticle()
 {
 	for (size_t i = 0; i < n; i++)
 	{
-		if (getRadialCoordinate(i) < CoreShellParticle::core_radius)
+		if (getRadialCoordinate(i) < config.core_radius)
 		{
-			_concentration_array_A[i] = CoreShellParticle::core_species.getMolarDensity(298.15);
+			_concentration_array_A[i] = config.core_species.getMolarDensity(298.15);
 			_concentration_array_B[i] = 0;
 		}
 		
 		else
 		{
 			_concentration_array_A[i] = 0;
-			_concentration_array_B[i] = CoreShellParticle::shell_species.getMolarDensity(298.15);
+			_concentration_array_B[i] = config.shell_species.getMolarDensity(298.15);
 		}
 	}
 
@@ -93,31 +75,67 @@ void CoreShellDiffusion::copyTo(CoreShellDiffusion &diffusion_problem)
 	diffusion_problem._mass_fraction_product_material = CoreShellParticle::_mass_fraction_product_material;
 }
 
-void CoreShellDiffusion::printConcentrationProfileA(std::ostream &output_stream, char delimiter, real_t curr_time) const
+void CoreShellDiffusion::writeState(std::ostream &output_stream) const
 {
-	output_stream << curr_time << delimiter;
+	output_stream.write((const char *) _concentration_array_A, n * sizeof(real_t));
+	output_stream.write((const char *) _concentration_array_B, n * sizeof(real_t));
+
+	output_stream.write((const char *) &_mass_fraction_core_material,		sizeof(real_t));
+	output_stream.write((const char *) &_mass_fraction_shell_material,		sizeof(real_t));
+	output_stream.write((const char *) &_mass_fraction_product_material,	sizeof(real_t));
+}
+
+void CoreShellDiffusion::readState(std::istream &input_stream)
+{
+	input_stream.read((char *) _concentration_array_A, n * sizeof(real_t));
+	input_stream.read((char *) _concentration_array_B, n * sizeof(real_t));
+
+	input_stream.read((char *) &_mass_fraction_core_material,	sizeof(real_t));
+	input_stream.read((char *) &_mass_fraction_shell_material,	sizeof(real_t));
+	input_stream.read((char *) &_mass_fraction_product_material,	sizeof(real_t));
+}
 
-	for (size_t i = 0; i < n-1; i++) output_stream << _concentration_array_A[i] << delimiter;
-	
-	output_stream << _concentration_array_A[n-1] << '\n';
+void CoreShellDiffusion::printConcentrationProfileA(std::ostream &output_stream, char delimiter, real_t curr_time) const
+{
+	printProfile(output_stream, curr_time, _concentration_array_A, n, delimiter);
 }
 
 void CoreShellDiffusion::printConcentrationProfileB(std::ostream &output_stream, char delimiter, real_t curr_time) const
 {
-	output_stream << curr_time << delimiter;
-	
-	for (size_t i = 0; i < n-1; i++) output_stream << _concentration_array_B[i] << delimiter;
-	
-	output_stream << _concentration_array_B[n-1] << '\n';
+	printProfile(output_stream, curr_time, _concentration_array_B, n, delimiter);
 }
 
 void CoreShellDiffusion::printGridPoints(
 	std::ostream &output_stream,
 	char delimiter
-) {
-	output_stream << NAN << delimiter;
-	
-	for (size_t i = 0; i < n - 1; i++) output_stream << getRadialCoordinate(i) << delimiter;
-	
-	output_stream << getRadialCoordinate(n-1) << '\n';
+) const {
+	std::vector<real_t> grid_points(n);
+	getGridPoints(grid_points.data());
+
+	printProfile(output_stream, NAN, grid_points.data(), n, delimiter);
+}
+
+void CoreShellDiffusion::getGridPoints(real_t *grid_points) const
+{
+	for (size_t i = 0; i < n; i++) grid_points[i] = getRadialCoordinate(i);
+}
+
+void CoreShellDiffusion::writeConcentrationFrameA(FrameWriter &frame_writer, real_t curr_time) const
+{
+	frame_writer.writeFrame(curr_time, _concentration_array_A);
+}
+
+void CoreShellDiffusion::writeConcentrationFrameB(FrameWriter &frame_writer, real_t curr_time) const
+{
+	frame_writer.writeFrame(curr_time, _concentration_array_B);
+}
+
+void CoreShellDiffusion::copyConcentrationProfileA(real_t *concentration) const
+{
+	std::memcpy(concentration, _concentration_array_A, n * sizeof(real_t));
+}
+
+void CoreShellDiffusion::copyConcentrationProfileB(real_t *concentration) const
+{
+	std::memcpy(concentration, _concentration_array_B, n * sizeof(real_t));
 }
@@ -0,0 +1,173 @@
+#include "pde-problems/Pellet-Flame-Propagation.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <cstdio>	// rename
+#include <cstdlib>
+#include <cstring>	// memcpy, memset
+
+static const char PELLET_CHECKPOINT_MAGIC[8] = {'P', 'E', 'L', 'L', 'E', 'T', 'C', 'K'};
+
+static PelletCheckpointHeader readPelletCheckpointHeader(std::istream &input_stream, const char *file_name)
+{
+	PelletCheckpointHeader header;
+
+	input_stream.read((char *) &header, sizeof(header));
+
+	if (input_stream.fail() || std::memcmp(header.magic, PELLET_CHECKPOINT_MAGIC, sizeof(PELLET_CHECKPOINT_MAGIC)) != 0)
+	{
+		std::cerr << "[ERROR] Not a checkpoint file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	if (header.version != PELLET_CHECKPOINT_VERSION)
+	{
+		std::cerr << "[ERROR] Checkpoint file " << file_name << " has version " << header.version;
+		std::cerr << ", expected version " << PELLET_CHECKPOINT_VERSION << std::endl;
+		std::abort();
+	}
+
+	if (header.value_size != sizeof(real_t))
+	{
+		std::cerr << "[ERROR] Checkpoint file " << file_name << " stores " << header.value_size;
+		std::cerr << " byte values, which this build cannot read" << std::endl;
+		std::abort();
+	}
+
+	return header;
+}
+
+PelletCheckpointHeader readPelletCheckpointHeader(const char *file_name)
+{
+	std::ifstream input_file(file_name, std::ios::binary);
+
+	if (!input_file.is_open())
+	{
+		std::cerr << "[ERROR] Could not open checkpoint file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	return readPelletCheckpointHeader(input_file, file_name);
+}
+
+void PelletFlamePropagation::writeCheckpoint(const char *file_name, size_t iteration, const RunState *run_state) const
+{
+	std::string temporary_file_name = std::string(file_name) + ".tmp";
+
+	std::ofstream output_file(temporary_file_name.c_str(), std::ios::binary);
+
+	PelletCheckpointHeader header;
+
+	// Clear padding so that identical states give identical files
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, PELLET_CHECKPOINT_MAGIC, sizeof(PELLET_CHECKPOINT_MAGIC));
+
+	header.version		= PELLET_CHECKPOINT_VERSION;
+	header.value_size	= sizeof(real_t);
+
+	header.m = m;
+	header.n = config.n;
+
+	header.config_hash	= config.getHash();
+	header.iteration	= iteration;
+
+	// Serialized first, as its size goes in the header
+	std::ostringstream run_state_stream;
+
+	if (run_state != NULL) run_state->writeState(run_state_stream);
+
+	const std::string run_state_bytes = run_state_stream.str();
+
+	header.run_state_size = run_state_bytes.size();
+
+	header.particle_volume_fractions	= PackedPellet::particle_volume_fractions;
+	header.time							= _time;
+
+	output_file.write((const char *) &header, sizeof(header));
+
+	output_file.write((const char *) _temperature_array, m * sizeof(real_t));
+
+	for (size_t i = 0; i < m; i++) output_file.write((const char *) &_node_values[i].thermal_conductivity,		sizeof(real_t));
+	for (size_t i = 0; i < m; i++) output_file.write((const char *) &_node_values[i].prev_enthalpy_particle,	sizeof(real_t));
+
+	for (size_t i = 0; i < m; i++) _particles_array[i].writeState(output_file);
+
+	output_file.write(run_state_bytes.data(), run_state_bytes.size());
+
+	output_file.close();
+
+	if (output_file.fail() || std::rename(temporary_file_name.c_str(), file_name) != 0)
+	{
+		std::cerr << "[ERROR] Could not write checkpoint file - " << file_name << std::endl;
+		std::abort();
+	}
+}
+
+size_t PelletFlamePropagation::readCheckpoint(const char *file_name, RunState *run_state)
+{
+	std::ifstream input_file(file_name, std::ios::binary);
+
+	if (!input_file.is_open())
+	{
+		std::cerr << "[ERROR] Could not open checkpoint file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	PelletCheckpointHeader header = readPelletCheckpointHeader(input_file, file_name);
+
+	if (header.m != m || header.n != config.n || header.config_hash != config.getHash())
+	{
+		std::cerr << "[ERROR] Checkpoint file " << file_name << " was written with a different configuration" << std::endl;
+		std::abort();
+	}
+
+	if (header.particle_volume_fractions != PackedPellet::particle_volume_fractions)
+	{
+		std::cerr << "[ERROR] Checkpoint file " << file_name << " was written for particle volume fractions ";
+		std::cerr << header.particle_volume_fractions << ", pellet has " << PackedPellet::particle_volume_fractions << std::endl;
+		std::abort();
+	}
+
+	_time = header.time;
+
+	input_file.read((char *) _temperature_array, m * sizeof(real_t));
+
+	for (size_t i = 0; i < m; i++) input_file.read((char *) &_node_values[i].thermal_conductivity,	sizeof(real_t));
+	for (size_t i = 0; i < m; i++) input_file.read((char *) &_node_values[i].prev_enthalpy_particle,	sizeof(real_t));
+
+	for (size_t i = 0; i < m; i++) _particles_array[i].readState(input_file);
+
+	if (run_state != NULL)
+	{
+		std::string run_state_bytes(header.run_state_size, '\0');
+		input_file.read(&run_state_bytes[0], run_state_bytes.size());
+
+		if (header.run_state_size == 0) std::cerr << "[WARNING] Checkpoint file " << file_name << " holds no run state" << std::endl;
+
+		else
+		{
+			std::istringstream run_state_stream(run_state_bytes);
+			run_state->readState(run_state_stream);
+
+			if (run_state_stream.fail() || run_state_stream.tellg() != (std::streamoff) run_state_bytes.size())
+			{
+				std::cerr << "[ERROR] Checkpoint file " << file_name << " holds run state of a different kind" << std::endl;
+				std::abort();
+			}
+		}
+	}
+
+	if (input_file.fail())
+	{
+		std::cerr << "[ERROR] Checkpoint file is truncated - " << file_name << std::endl;
+		std::abort();
+	}
+
+	// Properties are a function of temperature alone, and are
+	// evaluated exactly as they were at the end of the last update
+	evaluateProperties();
+
+	return header.iteration;
+}
\ No newline at end of file
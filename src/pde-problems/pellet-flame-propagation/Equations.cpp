@@ -2,6 +2,13 @@
 
 #include <cmath>
 
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+#include "utilities/Phase-Timer.hpp"
+#include "utilities/Trace-Recorder.hpp"
+
 #define STEFAN_BOLTZMANN_CONSTANT 5.670374419E-8 // W / m2 - K4
 
 inline
@@ -22,33 +29,112 @@ bool PelletFlamePropagation::isCombustionComplete()
 	return flag;
 }
 
+size_t PelletFlamePropagation::getNumberOfReactingNodes()
+{
+	size_t number_of_reacting_nodes = 0;
+
+	for (size_t i = 1; i < m-1; i++) if (inReactionZone(i)) number_of_reacting_nodes++;
+
+	return number_of_reacting_nodes;
+}
+
+// Evaluates the thermo-physical properties of the interstitial gas and
+// the particle species at the current temperature of grid point # i,
+// to be reused until the temperature is updated again
+inline void PelletFlamePropagation::evaluateProperties(size_t i)
+{
+	_interstitial_gas_properties[i]	= PackedPellet::interstitial_gas.evaluateAll(_temperature_array[i], PackedPellet::ambient_pressure);
+
+	_core_species_properties[i]		= config.core_species.evaluateAll(_temperature_array[i]);
+	_shell_species_properties[i]	= config.shell_species.evaluateAll(_temperature_array[i]);
+	_product_species_properties[i]	= config.product_species.evaluateAll(_temperature_array[i]);
+}
+
+// Evaluates the thermo-physical properties at the current temperatures of all interior grid points
+void PelletFlamePropagation::evaluateProperties()
+{
+	#pragma omp parallel for default(shared) schedule(static, 1)
+
+		for (size_t i = 1; i < m-1; i++) evaluateProperties(i);
+}
+
+// Returns properties of the particle at the current temperature of grid point # i
+inline PropertyBundle PelletFlamePropagation::getParticleProperties(const CoreShellParticle &particle, size_t i)
+{
+	return particle.evaluateAll(
+		_core_species_properties[i],
+		_shell_species_properties[i],
+		_product_species_properties[i]
+	);
+}
+
+// Parallelizes within particles when the reacting grid points are too few
+// to give every thread of the team a reacting grid point
+void PelletFlamePropagation::chooseParticleParallelism()
+{
+	_species_tasks = false;
+
+	if (_species_tasks_threshold == 0 || config.n < _species_tasks_threshold) return;
+
+	#ifdef _OPENMP
+		size_t number_of_threads = omp_get_max_threads();
+	#else
+		size_t number_of_threads = 1;
+	#endif
+
+	if (number_of_threads == 1) return;
+
+	_species_tasks = getNumberOfReactingNodes() < number_of_threads;
+
+	if (_species_tasks) _species_tasks_iterations++;
+}
+
+// Evolves particle at temperature from the state of diffusion_problem
+inline void PelletFlamePropagation::evolveParticle(
+	CoreShellDiffusion &particle,
+	real_t temperature,
+	CoreShellDiffusion &diffusion_problem
+) {
+	if (_species_tasks) particle.evolveSpeciesConcurrently(temperature, diffusion_problem);
+
+	else
+	{
+		particle.setUpEquations(temperature, diffusion_problem);
+		particle.solveEquations();
+	}
+}
+
 void PelletFlamePropagation::evolveParticleForEnthalpyDerivative(size_t i)
 {
-	_particles_array_const_temperature_evolution[i].setUpEquations(
+	ScopedTraceEvent trace_event("enthalpy_derivative", i);
+
+	evolveParticle(
+		_particles_array_const_temperature_evolution[i],
 		_temperature_array[i],
 		_particles_array[i]
 	);
 
-	_particles_array_const_temperature_evolution[i].solveEquations();
-
-	_particles_array_raised_temperature_evolution[i].setUpEquations(
+	evolveParticle(
+		_particles_array_raised_temperature_evolution[i],
 		_temperature_array[i] + delta_T,
 		_particles_array[i]
 	);
-
-	_particles_array_raised_temperature_evolution[i].solveEquations();
 }
 
 inline LinearExpression PelletFlamePropagation::calcTransientTerm(size_t i)
 {
-	static const real_t delta_t_inverse				= 1. / delta_t;
-	static const real_t gamma_by_delta_t			= gamma / delta_t;
-	static const real_t one_minus_gamma_by_delta_t	= (1. - gamma) / delta_t;
-	static const real_t gamma_by_delta_T_delta_t	= gamma / (delta_t * delta_T);
+	const real_t delta_t_inverse				= 1. / delta_t;
+	const real_t gamma_by_delta_t			= gamma / delta_t;
+	const real_t one_minus_gamma_by_delta_t	= (1. - gamma) / delta_t;
+	const real_t gamma_by_delta_T_delta_t	= gamma / (delta_t * delta_T);
+
+	ScopedPhaseTimer timer(PHASE_TRANSIENT_TERM);
 	
 	LinearExpression expression;
+
+	PropertyBundle particle_properties = getParticleProperties(_particles_array[i], i);
 	
-	expression.a_1 = _particles_array[i].getHeatCapacity(_temperature_array[i]) * delta_t_inverse;
+	expression.a_1 = particle_properties.heat_capacity * delta_t_inverse;
 	
 	expression.a_0 = 0.0;
 
@@ -56,13 +142,13 @@ inline LinearExpression PelletFlamePropagation::calcTransientTerm(size_t i)
 	{
 		evolveParticleForEnthalpyDerivative(i);
 
-		real_t enthalpy						= _particles_array[i].getEnthalpy(_temperature_array[i]);
-		real_t enthalpy_const_T_evolution	= _particles_array_const_temperature_evolution[i].getEnthalpy(_temperature_array[i]);
-		real_t enthalpy_raised_T_evolution	= _particles_array_raised_temperature_evolution[i].getEnthalpy(_temperature_array[i]);
+		real_t enthalpy						= particle_properties.enthalpy;
+		real_t enthalpy_const_T_evolution	= getParticleProperties(_particles_array_const_temperature_evolution[i], i).enthalpy;
+		real_t enthalpy_raised_T_evolution	= getParticleProperties(_particles_array_raised_temperature_evolution[i], i).enthalpy;
 		
 		expression.a_1	+=	gamma_by_delta_T_delta_t * (enthalpy_raised_T_evolution - enthalpy_const_T_evolution);
 
-		expression.a_0	+=	one_minus_gamma_by_delta_t * (enthalpy - _prev_enthalpy_particle[i])
+		expression.a_0	+=	one_minus_gamma_by_delta_t * (enthalpy - _node_values[i].prev_enthalpy_particle)
 						+ 	gamma_by_delta_t * (enthalpy_const_T_evolution - enthalpy);
 	}
 
@@ -73,8 +159,10 @@ inline LinearExpression PelletFlamePropagation::calcTransientTerm(size_t i)
 
 inline LinearExpression PelletFlamePropagation::calcHeatLossTerm(size_t i)
 {
-	static const real_t constant1 = PackedPellet::radiative_emissivity * STEFAN_BOLTZMANN_CONSTANT;
-	static const real_t constant2 = 4. * constant1;
+	const real_t constant1 = PackedPellet::radiative_emissivity * STEFAN_BOLTZMANN_CONSTANT;
+	const real_t constant2 = 4. * constant1;
+
+	ScopedPhaseTimer timer(PHASE_HEAT_LOSS_TERM);
 
 	LinearExpression expression;
 
@@ -97,21 +185,23 @@ inline LinearExpression PelletFlamePropagation::calcHeatLossTerm(size_t i)
 
 inline real_t PelletFlamePropagation::getInterstitialGasTransientTermCoefficient(size_t i)
 {
-	static const real_t constant = PackedPellet::interstitial_volume_fractions / delta_t;
+	const real_t constant = PackedPellet::interstitial_volume_fractions / delta_t;
 
 	return
 		constant * 
-		PackedPellet::interstitial_gas.getDensity(_temperature_array[i], PackedPellet::ambient_pressure) *
-		PackedPellet::interstitial_gas.getCp(_temperature_array[i]);
+		_interstitial_gas_properties[i].density *
+		_interstitial_gas_properties[i].heat_capacity;
 }
 
-inline void PelletFlamePropagation::setUpBoundaryConditionX0()
+void PelletFlamePropagation::setUpBoundaryConditionX0()
 {
-	static const real_t one_by_delta_x = 1. / delta_x;
+	const real_t one_by_delta_x = 1. / delta_x;
+
+	ScopedPhaseTimer timer(PHASE_BOUNDARY_CONDITIONS);
 	
 	LinearExpression beta = calcHeatLossTerm(0);
 	
-	real_t lambda_by_delta_x = _thermal_conductivity[0] * one_by_delta_x;
+	real_t lambda_by_delta_x = _node_values[0].thermal_conductivity * one_by_delta_x;
 	
 	_solver.setEquationFirstRow(
 		- lambda_by_delta_x,
@@ -120,13 +210,15 @@ inline void PelletFlamePropagation::setUpBoundaryConditionX0()
 	);
 }
 
-inline void PelletFlamePropagation::setUpBoundaryConditionXN()
+void PelletFlamePropagation::setUpBoundaryConditionXN()
 {
-	static const real_t constant = 1. / delta_x;
+	const real_t constant = 1. / delta_x;
+
+	ScopedPhaseTimer timer(PHASE_BOUNDARY_CONDITIONS);
 	
 	LinearExpression beta = calcHeatLossTerm(m-1);
 
-	real_t lambda_by_delta_x = _thermal_conductivity[m - 1] * constant;
+	real_t lambda_by_delta_x = _node_values[m - 1].thermal_conductivity * constant;
 	
 	_solver.setEquationLastRow(
 		- beta.a_1 + lambda_by_delta_x,
@@ -135,47 +227,72 @@ inline void PelletFlamePropagation::setUpBoundaryConditionXN()
 	);
 }
 
+// Sets up the equation of interior grid point # i in its node values
+void PelletFlamePropagation::setUpEquation(size_t i)
+{
+	const real_t one_minus_kappa			= 1.0 - kappa;
+	const real_t half_by_delta_x_sqr		= 0.5 / (delta_x * delta_x);
+	const real_t four_by_pellet_diameter = 4.0 / PackedPellet::diameter;
+
+	ScopedTraceEvent node_trace_event("node_equation", i);
+
+	LinearExpression alpha;
+
+	{
+		ScopedNodeCostTimer node_cost_timer(_node_cost_map, NODE_COST_TRANSIENT_TERM, i);
+
+		alpha = calcTransientTerm(i);
+	}
+
+	LinearExpression beta = calcHeatLossTerm(i) * four_by_pellet_diameter;
+
+	real_t coeff_fluid = getInterstitialGasTransientTermCoefficient(i);
+
+	real_t lambda_forward_by_delta_x_sqr  = half_by_delta_x_sqr * (_node_values[i+1].thermal_conductivity + _node_values[i].thermal_conductivity);
+	real_t lambda_backward_by_delta_x_sqr = half_by_delta_x_sqr * (_node_values[i].thermal_conductivity + _node_values[i-1].thermal_conductivity);
+
+	real_t kappa_lambda_forward_by_delta_x_sqr  = kappa * lambda_forward_by_delta_x_sqr;
+	real_t kappa_lambda_backward_by_delta_x_sqr = kappa * lambda_backward_by_delta_x_sqr;
+
+	PelletNodeValues &node_values = _node_values[i];
+
+	node_values.e = - kappa_lambda_forward_by_delta_x_sqr;
+
+	node_values.f =
+		alpha.a_1 + coeff_fluid + beta.a_1
+		+ kappa_lambda_backward_by_delta_x_sqr + kappa_lambda_forward_by_delta_x_sqr;
+
+	node_values.g = - kappa_lambda_backward_by_delta_x_sqr;
+
+	node_values.b =
+		- alpha.evaluateExpression(-_temperature_array[i]) + coeff_fluid * _temperature_array[i]
+		- beta.evaluateExpression(-_temperature_array[i])
+		+ one_minus_kappa * (
+			lambda_forward_by_delta_x_sqr  * (_temperature_array[i+1] - _temperature_array[i]) -
+			lambda_backward_by_delta_x_sqr * (_temperature_array[i] - _temperature_array[i-1])
+		);
+}
+
+// Rows of the solver matrix share cache lines, hence they are written in order by a single thread
+void PelletFlamePropagation::copyEquations(size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; i++) _solver.setEquation(i, _node_values[i].e, _node_values[i].f, _node_values[i].g, _node_values[i].b);
+}
+
 void PelletFlamePropagation::setUpEquations()
 {
+	ScopedTraceEvent trace_event("setUpEquations");
+
+	// Held until the equations of the next iteration are set up
+	chooseParticleParallelism();
+
 	setUpBoundaryConditionX0();
 
-	static const real_t one_minus_kappa			= 1.0 - kappa;
-	static const real_t half_by_delta_x_sqr		= 0.5 / (delta_x * delta_x);
-	static const real_t four_by_pellet_diameter = 4.0 / PackedPellet::diameter;
-	
 	#pragma omp parallel for default(shared) schedule(static, 1)
 
-		for (size_t i = 1; i < m-1; i++)
-		{
-			LinearExpression alpha = calcTransientTerm(i);
-
-			LinearExpression beta = calcHeatLossTerm(i) * four_by_pellet_diameter;
-
-			real_t coeff_fluid = getInterstitialGasTransientTermCoefficient(i);
-
-			real_t lambda_forward_by_delta_x_sqr  = half_by_delta_x_sqr * (_thermal_conductivity[i+1] + _thermal_conductivity[i]);
-			real_t lambda_backward_by_delta_x_sqr = half_by_delta_x_sqr * (_thermal_conductivity[i] + _thermal_conductivity[i-1]);
-
-			real_t kappa_lambda_forward_by_delta_x_sqr  = kappa * lambda_forward_by_delta_x_sqr;
-			real_t kappa_lambda_backward_by_delta_x_sqr = kappa * lambda_backward_by_delta_x_sqr;
-
-			_solver.setEquation(
-				i,
-				- kappa_lambda_forward_by_delta_x_sqr,
-				
-				alpha.a_1 + coeff_fluid + beta.a_1
-				+ kappa_lambda_backward_by_delta_x_sqr + kappa_lambda_forward_by_delta_x_sqr,
-				
-				- kappa_lambda_backward_by_delta_x_sqr,
-				
-				- alpha.evaluateExpression(-_temperature_array[i]) + coeff_fluid * _temperature_array[i]
-				- beta.evaluateExpression(-_temperature_array[i])
-				+ one_minus_kappa * (
-					lambda_forward_by_delta_x_sqr  * (_temperature_array[i+1] - _temperature_array[i]) -
-					lambda_backward_by_delta_x_sqr * (_temperature_array[i] - _temperature_array[i-1])
-				)
-			);
-		}
+		for (size_t i = 1; i < m-1; i++) setUpEquation(i);
+
+	copyEquations(1, m-1);
 	
 	setUpBoundaryConditionXN();
 }
@@ -183,29 +300,60 @@ void PelletFlamePropagation::setUpEquations()
 void PelletFlamePropagation::solveEquations()
 {
 	_time += delta_t;
-	
-	_solver.getSolution(_temperature_array);
+
+	{
+		ScopedPhaseTimer timer(PHASE_PELLET_SOLVE);
+		ScopedTraceEvent trace_event("pellet_solve");
+
+		_solver.getSolution(_temperature_array);
+	}
 	
 	updateParticles();
 }
 
+// Updates the particle, properties and thermal conductivity of interior
+// grid point # i to the temperature just solved for
+void PelletFlamePropagation::updateParticle(size_t i)
+{
+	ScopedTraceEvent node_trace_event("node_update", i);
+	ScopedNodeCostTimer node_cost_timer(_node_cost_map, NODE_COST_PARTICLE_UPDATE, i);
+
+	evaluateProperties(i);
+
+	_node_values[i].prev_enthalpy_particle = getParticleProperties(_particles_array[i], i).enthalpy;
+
+	if (inReactionZone(i))
+	{
+		ScopedPhaseTimer timer(PHASE_PARTICLE_UPDATE);
+		ScopedTraceEvent particle_trace_event("particle_solve", i);
+
+		evolveParticle(_particles_array[i], _temperature_array[i], _particles_array[i]);
+	}
+
+	ScopedPhaseTimer timer(PHASE_THERMAL_CONDUCTIVITY);
+	
+	_node_values[i].thermal_conductivity = PackedPellet::getThermalConductivity(
+		_interstitial_gas_properties[i].thermal_conductivity,
+		getParticleProperties(_particles_array[i], i).thermal_conductivity
+	);
+}
+
 void PelletFlamePropagation::updateParticles()
 {
+	ScopedTraceEvent trace_event("updateParticles");
+
 	#pragma omp parallel for default(shared) schedule(static, 1)
 		
-		for (size_t i = 1; i < m-1; i++)
-		{
-			_prev_enthalpy_particle[i] = _particles_array[i].getEnthalpy(_temperature_array[i]);
-
-			if (inReactionZone(i))
-			{
-				_particles_array[i].setUpEquations(_temperature_array[i]);
-				_particles_array[i].solveEquations();
-			}
-			
-			_thermal_conductivity[i] = PackedPellet::getThermalConductivity(_particles_array + i, _temperature_array[i]);
-		}
-
-	_thermal_conductivity[0]	= PackedPellet::getThermalConductivity(_particles_array + 1, 		_temperature_array[0]);
-	_thermal_conductivity[m-1]	= PackedPellet::getThermalConductivity(_particles_array + (m - 2),_temperature_array[m-1]);
+		for (size_t i = 1; i < m-1; i++) updateParticle(i);
+
+	updateBoundaryThermalConductivities();
+}
+
+// Updates the thermal conductivity at the ends from that of the interior grid points next to them
+void PelletFlamePropagation::updateBoundaryThermalConductivities()
+{
+	ScopedPhaseTimer timer(PHASE_THERMAL_CONDUCTIVITY);
+
+	_node_values[0].thermal_conductivity	= PackedPellet::getThermalConductivity(_particles_array + 1, 		_temperature_array[0]);
+	_node_values[m-1].thermal_conductivity	= PackedPellet::getThermalConductivity(_particles_array + (m - 2),_temperature_array[m-1]);
 }
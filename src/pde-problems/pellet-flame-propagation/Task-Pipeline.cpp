@@ -0,0 +1,89 @@
+#include "pde-problems/Pellet-Flame-Propagation.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#include "utilities/Phase-Timer.hpp"
+#include "utilities/Trace-Recorder.hpp"
+
+// Blocks hold the interior grid points in runs of PELLET_TASK_BLOCK_NODES from
+// grid point # 1. The first block also holds grid point # 0 and the last also
+// grid point # m-1. Equations are copied to the solver by the forward
+// substitution of their block, which runs in order of blocks.
+
+inline size_t PelletFlamePropagation::getTaskBlockBegin(size_t block) const
+{
+	return block == 0 ? 0 : 1 + block * PELLET_TASK_BLOCK_NODES;
+}
+
+inline size_t PelletFlamePropagation::getTaskBlockEnd(size_t block) const
+{
+	size_t end = 1 + (block + 1) * PELLET_TASK_BLOCK_NODES;
+
+	return end >= m-1 ? m : end;
+}
+
+void PelletFlamePropagation::setUpAndSolveEquationsAsTasks()
+{
+	ScopedTraceEvent trace_event("setUpAndSolveEquationsAsTasks");
+
+	chooseParticleParallelism();
+
+	_time += delta_t;
+
+	const size_t number_of_blocks = (m - 2 + PELLET_TASK_BLOCK_NODES - 1) / PELLET_TASK_BLOCK_NODES;
+
+	// Only the addresses matter, tasks depend on each other through them. The flag
+	// after the last block orders the substitutions of all blocks, forward then backward.
+	// Elements are named through data() as depend clauses take array sections of pointers only.
+	std::vector<char> set_up_flags(number_of_blocks), solved_flags(number_of_blocks + 1);
+
+	#pragma omp parallel default(shared)
+	{
+		#pragma omp single
+		{
+			for (size_t block = 0; block < number_of_blocks; block++)
+			{
+				#pragma omp task default(shared) firstprivate(block) depend(out: set_up_flags.data()[block])
+				{
+					if (block == 0) setUpBoundaryConditionX0();
+
+					for (size_t i = std::max(getTaskBlockBegin(block), (size_t) 1); i < std::min(getTaskBlockEnd(block), m-1); i++) setUpEquation(i);
+
+					if (block == number_of_blocks - 1) setUpBoundaryConditionXN();
+				}
+			}
+
+			for (size_t block = 0; block < number_of_blocks; block++)
+			{
+				#pragma omp task default(shared) firstprivate(block) depend(in: set_up_flags.data()[block]) depend(inout: solved_flags.data()[number_of_blocks])
+				{
+					ScopedPhaseTimer timer(PHASE_PELLET_SOLVE);
+					ScopedTraceEvent block_trace_event("forward_substitution", block);
+
+					copyEquations(std::max(getTaskBlockBegin(block), (size_t) 1), std::min(getTaskBlockEnd(block), m-1));
+
+					_solver.decomposeAndForwardSubstitute(std::max(getTaskBlockBegin(block), (size_t) 1), getTaskBlockEnd(block));
+				}
+			}
+
+			for (size_t block = number_of_blocks; block-- > 0;)
+			{
+				#pragma omp task default(shared) firstprivate(block) depend(inout: solved_flags.data()[number_of_blocks]) depend(out: solved_flags.data()[block])
+				{
+					ScopedPhaseTimer timer(PHASE_PELLET_SOLVE);
+					ScopedTraceEvent block_trace_event("backward_substitution", block);
+
+					_solver.backSubstitute(_temperature_array, getTaskBlockBegin(block), getTaskBlockEnd(block));
+				}
+
+				#pragma omp task default(shared) firstprivate(block) depend(in: solved_flags.data()[block])
+				{
+					for (size_t i = std::max(getTaskBlockBegin(block), (size_t) 1); i < std::min(getTaskBlockEnd(block), m-1); i++) updateParticle(i);
+				}
+			}
+		}
+	}
+
+	updateBoundaryThermalConductivities();
+}
\ No newline at end of file
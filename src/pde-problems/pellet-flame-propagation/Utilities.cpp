@@ -1,32 +1,123 @@
 #include "pde-problems/Pellet-Flame-Propagation.hpp"
 
-#include "utilities/Read-Data.hpp"
+#include <new>		// placement new
+#include <cstring>	// memcpy
+#include <cstdlib>	// abort
+#include <iostream>
+#include <vector>
+#include <algorithm>	// max_element
 
-const real_t PelletFlamePropagation::kappa = readScalarData<real_t>("data/PDE-solver-config", "kappa.txt");
-const real_t PelletFlamePropagation::gamma = readScalarData<real_t>("data/PDE-solver-config", "gamma.txt");
+#include "utilities/Profile-Formatter.hpp"
 
-const size_t PelletFlamePropagation::m		 = readScalarData<real_t>("data/PDE-solver-config", "number-of-grid-points-pellet.txt");
-const real_t PelletFlamePropagation::delta_x = readScalarData<real_t>("data/pellet", "length.txt") / ((real_t) PelletFlamePropagation::m - 1.);
+// Allocates an array of particles sharing the same config,
+// as CoreShellDiffusion has no default constructor.
+// Each interior particle is constructed by the thread that updates it in the
+// solver loops, which map grid points to threads with schedule(static, 1).
+// Its concentration profiles and solver workspaces are thus allocated and
+// first touched by that thread, placing their pages on its memory node.
+CoreShellDiffusion * allocateParticlesArray(const SimulationConfig &config, size_t size)
+{
+	CoreShellDiffusion * particles_array = allocateCacheAlignedArray<CoreShellDiffusion>(size);
+
+	new (particles_array) CoreShellDiffusion(config);
+
+	#pragma omp parallel for default(shared) schedule(static, 1)
+
+		for (size_t i = 1; i < size-1; i++) new (particles_array + i) CoreShellDiffusion(config);
+
+	new (particles_array + size - 1) CoreShellDiffusion(config);
+
+	return particles_array;
+}
+
+void deallocateParticlesArray(CoreShellDiffusion * particles_array, size_t size)
+{
+	for (size_t i = 0; i < size; i++) particles_array[i].~CoreShellDiffusion();
+
+	deallocateCacheAlignedArray(particles_array);
+}
+
+size_t PelletFlamePropagation::_memory_budget = 0;
+
+void PelletFlamePropagation::setMemoryBudget(size_t bytes)
+{
+	_memory_budget = bytes;
+}
+
+PelletMemoryFootprint PelletFlamePropagation::getMemoryFootprint(size_t m, size_t n)
+{
+	PelletMemoryFootprint footprint;
+
+	footprint.temperatures	= m * sizeof(real_t) + getCacheAlignedArrayBytes<PelletNodeValues>(m);
+	footprint.property_bundles	= 4 * getCacheAlignedArrayBytes<PropertyBundle>(m);
+	footprint.particles	= 3 * getCacheAlignedArrayBytes<CoreShellDiffusion>(m);
 
-const real_t PelletFlamePropagation::delta_t = readScalarData<real_t>("data/PDE-solver-config", "delta_t.txt");
+	footprint.particle_profiles	= 3 * m * 2 * n * sizeof(real_t);
+	footprint.particle_solver_workspaces	= 3 * m * 2 * LUSolver::getAllocatedBytes(n);
 
-const real_t PelletFlamePropagation::delta_T = readScalarData<real_t>("data/PDE-solver-config", "delta_T.txt");
+	footprint.pellet_solver_workspace	= LUSolver::getAllocatedBytes(m);
+
+	return footprint;
+}
+
+// Prints bytes in MB with the exact count
+static void printBytes(std::ostream &output_stream, const char *name, size_t bytes)
+{
+	output_stream << name << ":\t" << bytes / 1048576.0 << " MB (" << bytes << " bytes)\n";
+}
+
+void PelletMemoryFootprint::print(std::ostream &output_stream) const
+{
+	printBytes(output_stream, "Temperatures", temperatures);
+	printBytes(output_stream, "Property Bundles", property_bundles);
+	printBytes(output_stream, "Particles", particles);
+	printBytes(output_stream, "Particle Profiles", particle_profiles);
+	printBytes(output_stream, "Particle Solver Workspaces", particle_solver_workspaces);
+	printBytes(output_stream, "Pellet Solver Workspace", pellet_solver_workspace);
+	printBytes(output_stream, "Total Memory", getTotal());
+}
 
 PelletFlamePropagation::PelletFlamePropagation(
+	const SimulationConfig &config,
 	real_t particle_volume_fraction
-) : PackedPellet(particle_volume_fraction),
-	_solver(m)
+) : PackedPellet(config, particle_volume_fraction),
+	_solver(config.m),
+	_node_cost_map(NULL),
+	_memory_footprint(getMemoryFootprint(config.m, config.n)),
+	_species_tasks_threshold(DEFAULT_SPECIES_TASKS_THRESHOLD),
+	_species_tasks(false),
+	_species_tasks_iterations(0),
+	kappa(config.kappa),
+	gamma(config.gamma),
+	m(config.m),
+	delta_x(config.delta_x),
+	delta_t(config.delta_t),
+	delta_T(config.delta_T)
 {
+	// Fail before the particles are allocated rather than being killed later
+	if (_memory_budget > 0 && _memory_footprint.getTotal() > _memory_budget)
+	{
+		_memory_footprint.print(std::cerr);
+
+		std::cerr << "[ERROR] Pellet of " << m << " grid points with particles of " << config.n << " grid points needs ";
+		std::cerr << _memory_footprint.getTotal() / 1048576.0 << " MB, over the budget of " << _memory_budget / 1048576.0 << " MB" << std::endl;
+		std::abort();
+	}
+
 	_temperature_array = new real_t[m];
 
-	_thermal_conductivity = new real_t[m];
+	// Values written by the parallel loops begin a cache line at every grid point
+	_node_values = allocateCacheAlignedArray<PelletNodeValues>(m);
 
-	_prev_enthalpy_particle = new real_t[m];
+	_interstitial_gas_properties	= allocateCacheAlignedArray<PropertyBundle>(m);
+	_core_species_properties	= allocateCacheAlignedArray<PropertyBundle>(m);
+	_shell_species_properties	= allocateCacheAlignedArray<PropertyBundle>(m);
+	_product_species_properties	= allocateCacheAlignedArray<PropertyBundle>(m);
 
-	_particles_array = new CoreShellDiffusion[m];
+	_particles_array = allocateParticlesArray(config, m);
 
-	_particles_array_const_temperature_evolution = new CoreShellDiffusion[m];
-	_particles_array_raised_temperature_evolution = new CoreShellDiffusion[m];
+	_particles_array_const_temperature_evolution = allocateParticlesArray(config, m);
+	_particles_array_raised_temperature_evolution = allocateParticlesArray(config, m);
 
 	initializePellet();
 }
@@ -35,17 +126,22 @@ PelletFlamePropagation::~PelletFlamePropagation()
 {
 	// Deallocate memory for temperature array
 	delete [] _temperature_array;
-	delete [] _thermal_conductivity;
-	delete [] _prev_enthalpy_particle;
+
+	deallocateCacheAlignedArray(_node_values);
+
+	deallocateCacheAlignedArray(_interstitial_gas_properties);
+	deallocateCacheAlignedArray(_core_species_properties);
+	deallocateCacheAlignedArray(_shell_species_properties);
+	deallocateCacheAlignedArray(_product_species_properties);
 
 	// Deallocate memory for core shell diffusion problems
-	delete [] _particles_array;
-	delete [] _particles_array_const_temperature_evolution;
-	delete [] _particles_array_raised_temperature_evolution;
+	deallocateParticlesArray(_particles_array, m);
+	deallocateParticlesArray(_particles_array_const_temperature_evolution, m);
+	deallocateParticlesArray(_particles_array_raised_temperature_evolution, m);
 }
 
 
-inline real_t PelletFlamePropagation::getXCoordinate(size_t index)
+inline real_t PelletFlamePropagation::getXCoordinate(size_t index) const
 {
 	return (real_t) index * delta_x;
 }
@@ -59,7 +155,7 @@ void PelletFlamePropagation::initializePellet(
 
 	real_t initial_ignition_length = PackedPellet::length * initial_ignition_length_fraction;
 
-	#pragma omp parallel for
+	#pragma omp parallel for default(shared) schedule(static, 1)
 
 		for (size_t i = 1; i < m-1; i++)
 		{
@@ -78,26 +174,117 @@ void PelletFlamePropagation::initializePellet(
 	updateParticles();
 }
 
+real_t PelletFlamePropagation::getFlameFrontPosition(real_t flame_temperature) const
+{
+	if (_temperature_array[m-1] >= flame_temperature) return getXCoordinate(m-1);
+
+	for (size_t i = m-1; i > 0; i--)
+	{
+		if (_temperature_array[i-1] >= flame_temperature)
+		{
+			return getXCoordinate(i-1) + delta_x *
+				(_temperature_array[i-1] - flame_temperature) /
+				(_temperature_array[i-1] - _temperature_array[i]);
+		}
+	}
+
+	return 0;
+}
+
+real_t PelletFlamePropagation::getMaxTemperature() const
+{
+	return *std::max_element(_temperature_array, _temperature_array + m);
+}
+
 void PelletFlamePropagation::printTemperatureProfile(
 	std::ostream &output_stream,
 	char delimiter
 ) {
-	output_stream << _time << delimiter;
-
-	for (size_t i = 0; i < m -1; i++) output_stream << _temperature_array[i] << delimiter;
-
-	output_stream << _temperature_array[m-1] << '\n';
+	printProfile(output_stream, _time, _temperature_array, m, delimiter);
 }
 
 void PelletFlamePropagation::printGridPoints(
 	std::ostream &output_stream,
 	char delimiter
 ) {
-	output_stream << NAN << delimiter;
+	std::vector<real_t> grid_points(m);
+	getGridPoints(grid_points.data());
+
+	printProfile(output_stream, NAN, grid_points.data(), m, delimiter);
+}
+
+void PelletFlamePropagation::getGridPoints(real_t *grid_points) const
+{
+	for (size_t i = 0; i < m; i++) grid_points[i] = getXCoordinate(i);
+}
+
+void PelletFlamePropagation::writeTemperatureFrame(FrameWriter &frame_writer) const
+{
+	frame_writer.writeFrame(_time, _temperature_array);
+}
+
+void PelletFlamePropagation::copyTemperatureProfile(real_t *temperature) const
+{
+	std::memcpy(temperature, _temperature_array, m * sizeof(real_t));
+}
+
+void PelletFlamePropagation::takeSnapshot(PelletSnapshot &snapshot) const
+{
+	snapshot.time = _time;
+
+	snapshot.x_grid_points.resize(m);
+	getGridPoints(snapshot.x_grid_points.data());
+
+	snapshot.temperature.assign(_temperature_array, _temperature_array + m);
+
+	size_t reaction_zone_begin = m, reaction_zone_end = 0;
+
+	for (size_t i = 1; i < m-1; i++)
+	{
+		if (
+			!_particles_array[i].isCombustionComplete() &&
+			_particles_array[i].getMassFractionsProductMaterial() > 1E-3
+		) {
+			if (reaction_zone_begin == m) reaction_zone_begin = i;
+
+			reaction_zone_end = i;
+		}
+	}
+
+	snapshot.particle_indices.clear();
+
+	if (reaction_zone_begin == m)
+	{
+		snapshot.reaction_zone_begin	= NAN;
+		snapshot.reaction_zone_end		= NAN;
+	}
+
+	else
+	{
+		snapshot.reaction_zone_begin	= getXCoordinate(reaction_zone_begin);
+		snapshot.reaction_zone_end		= getXCoordinate(reaction_zone_end);
+
+		snapshot.particle_indices.push_back(reaction_zone_begin);
+
+		if (reaction_zone_end > reaction_zone_begin + 1) snapshot.particle_indices.push_back((reaction_zone_begin + reaction_zone_end) / 2);
+		if (reaction_zone_end > reaction_zone_begin) snapshot.particle_indices.push_back(reaction_zone_end);
+	}
+
+	snapshot.flame_front_position = getFlameFrontPosition();
+
+	const size_t n = config.n;
+
+	snapshot.r_grid_points.resize(n);
+	_particles_array[1].getGridPoints(snapshot.r_grid_points.data());
 
-	for (size_t i = 0; i < m - 1; i++) output_stream << getXCoordinate(i) << delimiter;
+	snapshot.concentration_A.resize(snapshot.particle_indices.size() * n);
+	snapshot.concentration_B.resize(snapshot.particle_indices.size() * n);
 
-	output_stream << getXCoordinate(m-1) << '\n';
+	for (size_t k = 0; k < snapshot.particle_indices.size(); k++)
+	{
+		_particles_array[snapshot.particle_indices[k]].copyConcentrationProfileA(snapshot.concentration_A.data() + k * n);
+		_particles_array[snapshot.particle_indices[k]].copyConcentrationProfileB(snapshot.concentration_B.data() + k * n);
+	}
 }
 
 void PelletFlamePropagation::printDiffusionParticleGridPoints(
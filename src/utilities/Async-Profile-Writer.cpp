@@ -0,0 +1,138 @@
+/**
+ * @file Async-Profile-Writer.cpp
+ * @brief Defines the ring of profile buffers drained by a writer thread
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Async-Profile-Writer.hpp"
+#include "utilities/Phase-Timer.hpp"
+#include "utilities/Thread-Affinity.hpp"
+
+#include <csignal>
+#include <pthread.h>
+
+AsyncProfileWriter::AsyncProfileWriter(
+	ProfileSink &sink,
+	size_t number_of_points,
+	size_t number_of_buffers
+) :	_sink(sink),
+	_number_of_points(number_of_points),
+	_number_of_buffers(number_of_buffers),
+	_buffers(number_of_buffers * number_of_points),
+	_times(number_of_buffers),
+	_head(0),
+	_tail(0),
+	_pending(0),
+	_number_of_stalls(0),
+	_stop(false)
+{
+	// Signals like keyboard interrupts must be handled by the simulation threads,
+	// hence they are blocked in the writer thread, which inherits the signal mask
+	sigset_t all_signals, previous_signals;
+	sigfillset(&all_signals);
+
+	pthread_sigmask(SIG_BLOCK, &all_signals, &previous_signals);
+
+	{
+		// The writer thread must not share the CPU of pinned OpenMP thread # 0
+		UnpinnedAffinityScope unpinned_affinity;
+
+		_writer_thread = std::thread(&AsyncProfileWriter::writeBuffers, this);
+	}
+
+	pthread_sigmask(SIG_SETMASK, &previous_signals, NULL);
+}
+
+AsyncProfileWriter::~AsyncProfileWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+
+	_buffer_submitted.notify_one();
+
+	_writer_thread.join();
+
+	_sink.flush();
+}
+
+real_t * AsyncProfileWriter::acquireBuffer()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	if (_pending == _number_of_buffers)
+	{
+		_number_of_stalls++;
+
+		while (_pending == _number_of_buffers) _buffer_written.wait(lock);
+	}
+
+	return _buffers.data() + _head * _number_of_points;
+}
+
+void AsyncProfileWriter::submitBuffer(real_t time)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_times[_head] = time;
+
+		_head = (_head + 1) % _number_of_buffers;
+		_pending++;
+	}
+
+	_buffer_submitted.notify_one();
+}
+
+void AsyncProfileWriter::flush()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	while (_pending > 0) _buffer_written.wait(lock);
+
+	// The writer thread does not touch the sink while no buffer is pending
+	_sink.flush();
+}
+
+size_t AsyncProfileWriter::getNumberOfStalls()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _number_of_stalls;
+}
+
+void AsyncProfileWriter::writeBuffers()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	while (true)
+	{
+		while (_pending == 0 && !_stop) _buffer_submitted.wait(lock);
+
+		if (_pending == 0) break;
+
+		size_t index = _tail;
+
+		// Format and write without holding the lock, the buffer
+		// is not handed out again until it is marked written
+		lock.unlock();
+
+		{
+			ScopedPhaseTimer timer(PHASE_OUTPUT);
+
+			_sink.writeProfile(_times[index], _buffers.data() + index * _number_of_points, _number_of_points);
+		}
+
+		lock.lock();
+
+		_tail = (_tail + 1) % _number_of_buffers;
+		_pending--;
+
+		_buffer_written.notify_all();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,326 @@
+/**
+ * @file Chunked-Frame-File.cpp
+ * @brief Writes and reads frames split over fixed size frame files with a time index
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Chunked-Frame-File.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static const char CHUNK_INDEX_MAGIC[8] = {'P', 'E', 'L', 'L', 'E', 'T', 'I', 'X'};
+
+std::string getChunkFileName(const std::string &directory, size_t chunk)
+{
+	char file_name[32];
+	std::snprintf(file_name, sizeof(file_name), CHUNK_FILE_NAME_FORMAT, (unsigned int) chunk);
+
+	return directory + "/" + file_name;
+}
+
+// Maps file_name read only and sets size to its size in bytes,
+// returns NULL for an empty file
+static const char * mapFile(const std::string &file_name, size_t &size)
+{
+	int file_descriptor = open(file_name.c_str(), O_RDONLY);
+
+	struct stat file_status;
+
+	if (file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0)
+	{
+		std::cerr << "[ERROR] Could not open file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	size = file_status.st_size;
+
+	void * memory = NULL;
+
+	if (size > 0)
+	{
+		memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+		if (memory == MAP_FAILED)
+		{
+			std::cerr << "[ERROR] Could not map file - " << file_name << std::endl;
+			std::abort();
+		}
+	}
+
+	close(file_descriptor);
+
+	return (const char *) memory;
+}
+
+ChunkedFrameWriter::ChunkedFrameWriter(
+	const std::string &directory,
+	size_t number_of_points,
+	const real_t *grid_points,
+	const char *quantity,
+	const char *quantity_units,
+	const char *grid_units,
+	size_t frames_per_chunk,
+	FrameDataType data_type
+) :	_directory(directory),
+	_number_of_points(number_of_points),
+	_grid_points(grid_points, grid_points + number_of_points),
+	_quantity(quantity),
+	_quantity_units(quantity_units),
+	_grid_units(grid_units),
+	_data_type(data_type),
+	_chunk_writer(NULL),
+	_number_of_chunks(0),
+	_number_of_frames(0),
+	frames_per_chunk(frames_per_chunk)
+{
+	if (frames_per_chunk == 0)
+	{
+		std::cerr << "[ERROR] Chunks must hold at least one frame" << std::endl;
+		std::abort();
+	}
+
+	mkdir(_directory.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+	_index_file.open((_directory + "/" + CHUNK_INDEX_FILE_NAME).c_str(), std::ios::binary);
+
+	ChunkIndexHeader header;
+
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, CHUNK_INDEX_MAGIC, sizeof(CHUNK_INDEX_MAGIC));
+
+	header.version			= CHUNK_INDEX_VERSION;
+	header.number_of_points	= number_of_points;
+	header.frames_per_chunk	= frames_per_chunk;
+
+	_index_file.write((const char *) &header, sizeof(header));
+
+	if (_index_file.fail())
+	{
+		std::cerr << "[ERROR] Could not create chunk index in " << _directory << std::endl;
+		std::abort();
+	}
+}
+
+ChunkedFrameWriter::~ChunkedFrameWriter()
+{
+	closeChunk();
+
+	_index_file.close();
+}
+
+void ChunkedFrameWriter::closeChunk()
+{
+	if (_chunk_writer == NULL) return;
+
+	// Writes the index and final header of the chunk
+	delete _chunk_writer;
+	_chunk_writer = NULL;
+
+	_chunk_file.close();
+
+	_index_file.flush();
+}
+
+void ChunkedFrameWriter::writeProfile(real_t time, const real_t *values, size_t number_of_points)
+{
+	if (number_of_points != _number_of_points)
+	{
+		std::cerr << "[ERROR] Profile of " << number_of_points << " points written to chunked frame files of ";
+		std::cerr << _number_of_points << " points" << std::endl;
+		std::abort();
+	}
+
+	if (_chunk_writer != NULL && _chunk_writer->getNumberOfFrames() == frames_per_chunk) closeChunk();
+
+	if (_chunk_writer == NULL)
+	{
+		_chunk_file.open(getChunkFileName(_directory, _number_of_chunks).c_str(), std::ios::binary);
+
+		if (_chunk_file.fail())
+		{
+			std::cerr << "[ERROR] Could not create chunk # " << _number_of_chunks << " in " << _directory << std::endl;
+			std::abort();
+		}
+
+		_chunk_writer = new FrameWriter(
+			_chunk_file,
+			_number_of_points,
+			_grid_points.data(),
+			_quantity.c_str(),
+			_quantity_units.c_str(),
+			_grid_units.c_str(),
+			_data_type
+		);
+
+		_number_of_chunks++;
+	}
+
+	_chunk_writer->writeFrame(time, values);
+
+	ChunkIndexEntry entry;
+
+	entry.time		= time;
+	entry.chunk		= _number_of_chunks - 1;
+	entry.reserved	= 0;
+	entry.offset	= _chunk_writer->getFrameOffset(_chunk_writer->getNumberOfFrames() - 1);
+
+	_index_file.write((const char *) &entry, sizeof(entry));
+
+	_number_of_frames++;
+}
+
+void ChunkedFrameWriter::flush()
+{
+	if (_chunk_writer != NULL) _chunk_writer->flush();
+
+	// After the chunk, so that indexed frames are on disk before their entries
+	_index_file.flush();
+}
+
+ChunkedFrameReader::ChunkedFrameReader(const char *directory) : _directory(directory)
+{
+	_index_memory = mapFile(_directory + "/" + CHUNK_INDEX_FILE_NAME, _index_size);
+
+	_header = (const ChunkIndexHeader *) _index_memory;
+
+	if (_index_size < sizeof(ChunkIndexHeader) || std::memcmp(_header->magic, CHUNK_INDEX_MAGIC, sizeof(CHUNK_INDEX_MAGIC)) != 0)
+	{
+		std::cerr << "[ERROR] Not a chunked frame directory - " << directory << std::endl;
+		std::abort();
+	}
+
+	if (_header->version != CHUNK_INDEX_VERSION)
+	{
+		std::cerr << "[ERROR] Chunk index of " << directory << " has version " << _header->version;
+		std::cerr << ", expected version " << CHUNK_INDEX_VERSION << std::endl;
+		std::abort();
+	}
+
+	_entries = (const ChunkIndexEntry *) (_index_memory + sizeof(ChunkIndexHeader));
+
+	// Entries are appended as frames are written, a partly written entry is ignored
+	_number_of_frames = (_index_size - sizeof(ChunkIndexHeader)) / sizeof(ChunkIndexEntry);
+
+	if (_number_of_frames == 0)
+	{
+		std::cerr << "[ERROR] No frames in chunked frame directory - " << directory << std::endl;
+		std::abort();
+	}
+
+	_chunks.resize(_entries[_number_of_frames - 1].chunk + 1);
+
+	for (size_t i = 0; i < _chunks.size(); i++)
+	{
+		_chunks[i].memory	= NULL;
+		_chunks[i].size		= 0;
+	}
+
+	// Grid and metadata are the same in every chunk
+	FrameReader first_chunk(getChunkFileName(_directory, 0).c_str());
+
+	_quantity		= first_chunk.getQuantity();
+	_quantity_units	= first_chunk.getQuantityUnits();
+	_grid_units		= first_chunk.getGridUnits();
+
+	_grid_points.assign(first_chunk.getGridPoints(), first_chunk.getGridPoints() + first_chunk.getNumberOfPoints());
+
+	std::ifstream first_chunk_file(getChunkFileName(_directory, 0).c_str(), std::ios::binary);
+	first_chunk_file.read((char *) &_chunk_header, sizeof(_chunk_header));
+
+	if (_chunk_header.number_of_points != _header->number_of_points)
+	{
+		std::cerr << "[ERROR] Chunks of " << directory << " do not match its index" << std::endl;
+		std::abort();
+	}
+}
+
+ChunkedFrameReader::~ChunkedFrameReader()
+{
+	for (size_t i = 0; i < _chunks.size(); i++)
+	{
+		if (_chunks[i].memory != NULL) munmap((void *) _chunks[i].memory, _chunks[i].size);
+	}
+
+	munmap((void *) _index_memory, _index_size);
+}
+
+const ChunkedFrameReader::MappedChunk & ChunkedFrameReader::getChunk(size_t chunk)
+{
+	if (_chunks[chunk].memory == NULL) _chunks[chunk].memory = mapFile(getChunkFileName(_directory, chunk), _chunks[chunk].size);
+
+	return _chunks[chunk];
+}
+
+size_t ChunkedFrameReader::findFrame(real_t time) const
+{
+	size_t begin = 0, end = _number_of_frames;
+
+	while (begin < end)
+	{
+		size_t middle = begin + (end - begin) / 2;
+
+		if (_entries[middle].time < time) begin = middle + 1;
+
+		else end = middle;
+	}
+
+	return begin;
+}
+
+void ChunkedFrameReader::readFrame(size_t frame_index, real_t &time, real_t *values)
+{
+	if (frame_index >= _number_of_frames)
+	{
+		std::cerr << "[ERROR] Frame # " << frame_index << " requested of " << _number_of_frames << " frames" << std::endl;
+		std::abort();
+	}
+
+	const ChunkIndexEntry &entry = _entries[frame_index];
+
+	const MappedChunk &chunk = getChunk(entry.chunk);
+
+	if (entry.offset + _chunk_header.frame_size > chunk.size)
+	{
+		std::cerr << "[ERROR] Chunk # " << entry.chunk << " is truncated" << std::endl;
+		std::abort();
+	}
+
+	const char * frame = chunk.memory + entry.offset;
+
+	convertFrameValues((FrameDataType) _chunk_header.data_type, 1, frame, &time);
+	convertFrameValues((FrameDataType) _chunk_header.data_type, _header->number_of_points, frame + _chunk_header.value_size, values);
+}
+
+size_t ChunkedFrameReader::readFrames(
+	real_t begin_time,
+	real_t end_time,
+	std::vector<real_t> &times,
+	std::vector<real_t> &values
+) {
+	size_t begin = findFrame(begin_time);
+	size_t end = begin;
+
+	while (end < _number_of_frames && _entries[end].time <= end_time) end++;
+
+	const size_t n = _header->number_of_points;
+
+	times.resize(end - begin);
+	values.resize((end - begin) * n);
+
+	for (size_t i = begin; i < end; i++) readFrame(i, times[i - begin], values.data() + (i - begin) * n);
+
+	return end - begin;
+}
\ No newline at end of file
@@ -0,0 +1,330 @@
+/**
+ * @file Compressed-Frame-File.cpp
+ * @brief Writes and reads losslessly compressed streams of time indexed frames
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Compressed-Frame-File.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include <zlib.h>
+
+static const char COMPRESSED_FRAME_FILE_MAGIC[8] = {'P', 'E', 'L', 'L', 'E', 'T', 'Z', 'F'};
+
+inline void writeString(std::ostream &output_stream, const char *string)
+{
+	std::uint32_t length = std::strlen(string);
+
+	output_stream.write((const char *) &length, sizeof(length));
+	output_stream.write(string, length);
+}
+
+inline std::string readString(std::istream &input_stream)
+{
+	std::uint32_t length = 0;
+	input_stream.read((char *) &length, sizeof(length));
+
+	std::string string(length, '\0');
+	input_stream.read(&string[0], length);
+
+	return string;
+}
+
+// Stores byte # b of value # i of number_of_values values of value_size bytes
+// in input at b * number_of_values + i of output
+inline void shuffleBytes(size_t number_of_values, size_t value_size, const char *input, char *output)
+{
+	for (size_t i = 0; i < number_of_values; i++)
+	{
+		for (size_t b = 0; b < value_size; b++) output[b * number_of_values + i] = input[i * value_size + b];
+	}
+}
+
+// Inverse of shuffleBytes
+inline void unshuffleBytes(size_t number_of_values, size_t value_size, const char *input, char *output)
+{
+	for (size_t b = 0; b < value_size; b++)
+	{
+		for (size_t i = 0; i < number_of_values; i++) output[i * value_size + b] = input[b * number_of_values + i];
+	}
+}
+
+CompressedFrameWriter::CompressedFrameWriter(
+	std::ostream &output_stream,
+	size_t number_of_points,
+	const real_t *grid_points,
+	const char *quantity,
+	const char *quantity_units,
+	const char *grid_units,
+	size_t frames_per_block,
+	FrameDataType data_type,
+	int compression_level
+) :	_output_stream(output_stream),
+	_number_of_frames(0),
+	_uncompressed_size(0),
+	_compressed_size(0),
+	compression_level(compression_level)
+{
+	if (frames_per_block == 0)
+	{
+		std::cerr << "[ERROR] Blocks must hold at least one frame" << std::endl;
+		std::abort();
+	}
+
+	std::memset(&_header, 0, sizeof(_header));
+	std::memcpy(_header.magic, COMPRESSED_FRAME_FILE_MAGIC, sizeof(COMPRESSED_FRAME_FILE_MAGIC));
+
+	_header.version				= COMPRESSED_FRAME_FILE_VERSION;
+	_header.data_type			= data_type;
+	_header.value_size			= getFrameDataTypeSize(data_type);
+	_header.frames_per_block	= frames_per_block;
+	_header.number_of_points	= number_of_points;
+
+	size_t frame_size = (number_of_points + 1) * _header.value_size;
+
+	_frame.assign(frame_size, 0);
+	_previous_frame.assign(frame_size, 0);
+
+	_block.reserve(frames_per_block * frame_size);
+	_shuffled_block.resize(frames_per_block * frame_size);
+	_compressed_block.resize(compressBound(frames_per_block * frame_size));
+
+	std::memset(&_block_header, 0, sizeof(_block_header));
+
+	_output_stream.write((const char *) &_header, sizeof(_header));
+
+	writeString(_output_stream, quantity);
+	writeString(_output_stream, quantity_units);
+	writeString(_output_stream, grid_units);
+
+	std::vector<char> grid_buffer(number_of_points * _header.value_size, 0);
+
+	convertToFrameValues(data_type, number_of_points, grid_points, grid_buffer.data());
+	_output_stream.write(grid_buffer.data(), grid_buffer.size());
+
+	if (_output_stream.fail())
+	{
+		std::cerr << "[ERROR] Could not write compressed frame file header" << std::endl;
+		std::abort();
+	}
+}
+
+CompressedFrameWriter::~CompressedFrameWriter()
+{
+	if (_block_header.number_of_frames > 0) writeBlock();
+
+	_output_stream.flush();
+}
+
+void CompressedFrameWriter::writeBlock()
+{
+	shuffleBytes(_block.size() / _header.value_size, _header.value_size, _block.data(), _shuffled_block.data());
+
+	uLongf compressed_size = _compressed_block.size();
+
+	if (compress2(_compressed_block.data(), &compressed_size, (const Bytef *) _shuffled_block.data(), _block.size(), compression_level) != Z_OK)
+	{
+		std::cerr << "[ERROR] Could not compress block of " << _block_header.number_of_frames << " frames" << std::endl;
+		std::abort();
+	}
+
+	_block_header.compressed_size = compressed_size;
+
+	_output_stream.write((const char *) &_block_header, sizeof(_block_header));
+	_output_stream.write((const char *) _compressed_block.data(), compressed_size);
+
+	if (_output_stream.fail())
+	{
+		std::cerr << "[ERROR] Could not write compressed frame block" << std::endl;
+		std::abort();
+	}
+
+	_uncompressed_size	+= _block.size();
+	_compressed_size	+= sizeof(_block_header) + compressed_size;
+
+	// The first frame of the next block is XORed with zeros, so that blocks decode independently
+	_block.clear();
+	std::fill(_previous_frame.begin(), _previous_frame.end(), 0);
+
+	_block_header.number_of_frames = 0;
+}
+
+void CompressedFrameWriter::writeProfile(real_t time, const real_t *values, size_t number_of_points)
+{
+	if (number_of_points != _header.number_of_points)
+	{
+		std::cerr << "[ERROR] Profile of " << number_of_points << " points written to compressed frame file of ";
+		std::cerr << _header.number_of_points << " points" << std::endl;
+		std::abort();
+	}
+
+	convertToFrameValues((FrameDataType) _header.data_type, 1, &time, _frame.data());
+	convertToFrameValues((FrameDataType) _header.data_type, number_of_points, values, _frame.data() + _header.value_size);
+
+	if (_block_header.number_of_frames == 0) _block_header.begin_time = time;
+
+	_block_header.end_time = time;
+
+	for (size_t i = 0; i < _frame.size(); i++) _block.push_back(_frame[i] ^ _previous_frame[i]);
+
+	_previous_frame.swap(_frame);
+
+	_number_of_frames++;
+
+	if (++_block_header.number_of_frames == _header.frames_per_block) writeBlock();
+}
+
+void CompressedFrameWriter::flush()
+{
+	_output_stream.flush();
+}
+
+CompressedFrameReader::CompressedFrameReader(const char *file_name) :
+	_input_stream(file_name, std::ios::binary),
+	_number_of_frames(0),
+	_decoded_block(-1)
+{
+	if (!_input_stream.is_open())
+	{
+		std::cerr << "[ERROR] Could not open compressed frame file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	_input_stream.read((char *) &_header, sizeof(_header));
+
+	if (_input_stream.fail() || std::memcmp(_header.magic, COMPRESSED_FRAME_FILE_MAGIC, sizeof(COMPRESSED_FRAME_FILE_MAGIC)) != 0)
+	{
+		std::cerr << "[ERROR] Not a compressed frame file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	if (_header.version != COMPRESSED_FRAME_FILE_VERSION)
+	{
+		std::cerr << "[ERROR] Compressed frame file " << file_name << " has version " << _header.version;
+		std::cerr << ", expected version " << COMPRESSED_FRAME_FILE_VERSION << std::endl;
+		std::abort();
+	}
+
+	if (_header.value_size != getFrameDataTypeSize((FrameDataType) _header.data_type))
+	{
+		std::cerr << "[ERROR] Compressed frame file " << file_name << " stores " << _header.value_size;
+		std::cerr << " byte values, which this build cannot read" << std::endl;
+		std::abort();
+	}
+
+	_quantity		= readString(_input_stream);
+	_quantity_units	= readString(_input_stream);
+	_grid_units		= readString(_input_stream);
+
+	std::vector<char> grid_buffer(_header.number_of_points * _header.value_size);
+
+	_input_stream.read(grid_buffer.data(), grid_buffer.size());
+
+	_grid_points.resize(_header.number_of_points);
+	convertFrameValues((FrameDataType) _header.data_type, _header.number_of_points, grid_buffer.data(), _grid_points.data());
+
+	std::streamoff position = _input_stream.tellg();
+
+	_input_stream.seekg(0, std::ios::end);
+	std::streamoff file_size = _input_stream.tellg();
+
+	// Only block headers are read, the compressed frames are skipped
+	while (position + (std::streamoff) sizeof(CompressedFrameBlockHeader) <= file_size)
+	{
+		CompressedFrameBlockHeader block_header;
+
+		_input_stream.seekg(position);
+		_input_stream.read((char *) &block_header, sizeof(block_header));
+
+		Block block;
+
+		block.offset			= position + sizeof(block_header);
+		block.compressed_size	= block_header.compressed_size;
+		block.first_frame		= _number_of_frames;
+		block.number_of_frames	= block_header.number_of_frames;
+
+		if (block.number_of_frames == 0 || block.number_of_frames > _header.frames_per_block) break;
+
+		if ((std::streamoff) (block.offset + block.compressed_size) > file_size) break;
+
+		_blocks.push_back(block);
+
+		_number_of_frames += block.number_of_frames;
+
+		position = block.offset + block.compressed_size;
+	}
+
+	_input_stream.clear();
+
+	size_t block_size = _header.frames_per_block * (_header.number_of_points + 1) * _header.value_size;
+
+	_compressed_block.reserve(compressBound(block_size));
+	_shuffled_block.reserve(block_size);
+	_decoded_frames.reserve(block_size);
+}
+
+void CompressedFrameReader::decodeBlock(size_t block)
+{
+	const Block &block_entry = _blocks[block];
+
+	const size_t frame_size = (_header.number_of_points + 1) * _header.value_size;
+
+	_compressed_block.resize(block_entry.compressed_size);
+
+	_input_stream.seekg(block_entry.offset);
+	_input_stream.read((char *) _compressed_block.data(), _compressed_block.size());
+
+	_shuffled_block.resize(block_entry.number_of_frames * frame_size);
+
+	uLongf uncompressed_size = _shuffled_block.size();
+
+	if (
+		_input_stream.fail() ||
+		uncompress((Bytef *) _shuffled_block.data(), &uncompressed_size, _compressed_block.data(), _compressed_block.size()) != Z_OK ||
+		uncompressed_size != _shuffled_block.size()
+	) {
+		std::cerr << "[ERROR] Could not decompress block # " << block << " of compressed frame file" << std::endl;
+		std::abort();
+	}
+
+	_decoded_frames.resize(_shuffled_block.size());
+
+	unshuffleBytes(_shuffled_block.size() / _header.value_size, _header.value_size, _shuffled_block.data(), _decoded_frames.data());
+
+	// Undo the XOR with the frame before
+	for (size_t i = frame_size; i < _decoded_frames.size(); i++) _decoded_frames[i] ^= _decoded_frames[i - frame_size];
+
+	_decoded_block = block;
+}
+
+void CompressedFrameReader::readFrame(size_t frame_index, real_t &time, real_t *values)
+{
+	if (frame_index >= _number_of_frames)
+	{
+		std::cerr << "[ERROR] Frame # " << frame_index << " requested of " << _number_of_frames << " frames" << std::endl;
+		std::abort();
+	}
+
+	// Last block starting at or before frame_index
+	size_t block = std::upper_bound(
+		_blocks.begin(), _blocks.end(), frame_index,
+		[](size_t frame, const Block &block_entry) { return frame < block_entry.first_frame; }
+	) - _blocks.begin() - 1;
+
+	if (block != _decoded_block) decodeBlock(block);
+
+	const size_t frame_size = (_header.number_of_points + 1) * _header.value_size;
+
+	const char * frame = _decoded_frames.data() + (frame_index - _blocks[block].first_frame) * frame_size;
+
+	convertFrameValues((FrameDataType) _header.data_type, 1, frame, &time);
+	convertFrameValues((FrameDataType) _header.data_type, _header.number_of_points, frame + _header.value_size, values);
+}
\ No newline at end of file
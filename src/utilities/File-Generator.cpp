@@ -103,4 +103,51 @@ std::ofstream FileGenerator::getTXTFile(std::string file_name, std::string folde
 	file.append(".txt");
 
     return std::ofstream(file);
+}
+
+std::ofstream FileGenerator::getFrameFile(std::string file_name)
+{
+    std::string file;
+    
+	file.clear();
+	file.append(_folder_name);
+	
+	file.append("/");
+    file.append(file_name);
+	file.append(".frames");
+
+    return std::ofstream(file, std::ios::binary);
+}
+
+std::ofstream FileGenerator::getFrameFile(std::string file_name, std::string folder)
+{
+    std::string file;
+    
+    file.clear();
+	file.append(_folder_name);
+	
+	file.append("/");
+	file.append(folder);
+
+	mkdir(file.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+   	file.append("/");
+    file.append(file_name);
+	file.append(".frames");
+
+    return std::ofstream(file, std::ios::binary);
+}
+
+std::ofstream FileGenerator::getCompressedFrameFile(std::string file_name)
+{
+    std::string file;
+    
+	file.clear();
+	file.append(_folder_name);
+	
+	file.append("/");
+    file.append(file_name);
+	file.append(".zframes");
+
+    return std::ofstream(file, std::ios::binary);
 }
\ No newline at end of file
@@ -0,0 +1,318 @@
+/**
+ * @file Frame-File.cpp
+ * @brief Writes and reads binary containers of time indexed frames
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Frame-File.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+static const char FRAME_FILE_MAGIC[8] = {'P', 'E', 'L', 'L', 'E', 'T', 'F', 'R'};
+
+// Frames and the grid start at multiples of this many bytes
+#define FRAME_FILE_ALIGNMENT 16
+
+size_t getFrameDataTypeSize(FrameDataType data_type)
+{
+	switch (data_type)
+	{
+		case FRAME_FLOAT32:		return sizeof(float);
+		case FRAME_FLOAT64:		return sizeof(double);
+		case FRAME_LONG_DOUBLE:	return sizeof(long double);
+	}
+
+	std::cerr << "[ERROR] Unknown frame data type " << (int) data_type << std::endl;
+	std::abort();
+}
+
+template<typename data_t>
+void convertToType(size_t number_of_values, const real_t *values, char *buffer)
+{
+	for (size_t i = 0; i < number_of_values; i++)
+	{
+		data_t value = values[i];
+		std::memcpy(buffer + i * sizeof(data_t), &value, sizeof(data_t));
+	}
+}
+
+template<typename data_t>
+void convertFromType(size_t number_of_values, const char *buffer, real_t *values)
+{
+	for (size_t i = 0; i < number_of_values; i++)
+	{
+		data_t value;
+		std::memcpy(&value, buffer + i * sizeof(data_t), sizeof(data_t));
+		values[i] = value;
+	}
+}
+
+void convertToFrameValues(FrameDataType data_type, size_t number_of_values, const real_t *values, char *buffer)
+{
+	switch (data_type)
+	{
+		case FRAME_FLOAT32:		convertToType<float>(number_of_values, values, buffer);			break;
+		case FRAME_FLOAT64:		convertToType<double>(number_of_values, values, buffer);		break;
+		case FRAME_LONG_DOUBLE:	convertToType<long double>(number_of_values, values, buffer);	break;
+	}
+}
+
+void convertFrameValues(FrameDataType data_type, size_t number_of_values, const char *buffer, real_t *values)
+{
+	switch (data_type)
+	{
+		case FRAME_FLOAT32:		convertFromType<float>(number_of_values, buffer, values);		break;
+		case FRAME_FLOAT64:		convertFromType<double>(number_of_values, buffer, values);		break;
+		case FRAME_LONG_DOUBLE:	convertFromType<long double>(number_of_values, buffer, values);	break;
+	}
+}
+
+inline void writeString(std::ostream &output_stream, const char *string)
+{
+	std::uint32_t length = std::strlen(string);
+
+	output_stream.write((const char *) &length, sizeof(length));
+	output_stream.write(string, length);
+}
+
+inline std::string readString(std::istream &input_stream)
+{
+	std::uint32_t length = 0;
+	input_stream.read((char *) &length, sizeof(length));
+
+	std::string string(length, '\0');
+	input_stream.read(&string[0], length);
+
+	return string;
+}
+
+inline void writePadding(std::ostream &output_stream)
+{
+	static const char padding[FRAME_FILE_ALIGNMENT] = {0};
+
+	std::streamoff position = output_stream.tellp();
+
+	output_stream.write(padding, (FRAME_FILE_ALIGNMENT - position % FRAME_FILE_ALIGNMENT) % FRAME_FILE_ALIGNMENT);
+}
+
+FrameWriter::FrameWriter(
+	std::ostream &output_stream,
+	size_t number_of_points,
+	const real_t *grid_points,
+	const char *quantity,
+	const char *quantity_units,
+	const char *grid_units,
+	FrameDataType data_type
+) :	_output_stream(output_stream),
+	_closed(false)
+{
+	std::memcpy(_header.magic, FRAME_FILE_MAGIC, sizeof(FRAME_FILE_MAGIC));
+
+	_header.version				= FRAME_FILE_VERSION;
+	_header.data_type			= data_type;
+	_header.value_size			= getFrameDataTypeSize(data_type);
+	_header.reserved			= 0;
+	_header.number_of_points	= number_of_points;
+	_header.frame_size			= (number_of_points + 1) * _header.value_size;
+	_header.number_of_frames	= 0;
+	_header.index_offset		= 0;
+
+	_buffer.resize(_header.frame_size);
+
+	_header_position = _output_stream.tellp();
+
+	// Placeholder until the offset of the frames is known
+	_output_stream.write((const char *) &_header, sizeof(_header));
+
+	writeString(_output_stream, quantity);
+	writeString(_output_stream, quantity_units);
+	writeString(_output_stream, grid_units);
+
+	writePadding(_output_stream);
+
+	convertValues(number_of_points, grid_points, _buffer.data());
+	_output_stream.write(_buffer.data(), number_of_points * _header.value_size);
+
+	writePadding(_output_stream);
+
+	_position = _output_stream.tellp();
+
+	_header.frames_offset = _position - _header_position;
+
+	_output_stream.seekp(_header_position);
+	_output_stream.write((const char *) &_header, sizeof(_header));
+	_output_stream.seekp(_position);
+
+	if (_output_stream.fail())
+	{
+		std::cerr << "[ERROR] Could not write frame file header" << std::endl;
+		std::abort();
+	}
+}
+
+FrameWriter::~FrameWriter()
+{
+	if (!_closed) close();
+}
+
+void FrameWriter::convertValues(size_t number_of_values, const real_t *values, char *buffer) const
+{
+	convertToFrameValues((FrameDataType) _header.data_type, number_of_values, values, buffer);
+}
+
+void FrameWriter::writeFrame(real_t time, const real_t *values)
+{
+	FrameIndexEntry entry;
+
+	entry.time		= time;
+	entry.offset	= _position - _header_position;
+
+	convertValues(1, &time, _buffer.data());
+	convertValues(_header.number_of_points, values, _buffer.data() + _header.value_size);
+
+	_output_stream.write(_buffer.data(), _buffer.size());
+
+	_position += _buffer.size();
+
+	_index.push_back(entry);
+}
+
+void FrameWriter::writeProfile(real_t time, const real_t *values, size_t number_of_points)
+{
+	if (number_of_points != _header.number_of_points)
+	{
+		std::cerr << "[ERROR] Profile of " << number_of_points << " points written to frame file of ";
+		std::cerr << _header.number_of_points << " points" << std::endl;
+		std::abort();
+	}
+
+	writeFrame(time, values);
+}
+
+void FrameWriter::flush()
+{
+	_output_stream.flush();
+}
+
+void FrameWriter::close()
+{
+	_header.number_of_frames	= _index.size();
+	_header.index_offset		= _position - _header_position;
+
+	_output_stream.write((const char *) _index.data(), _index.size() * sizeof(FrameIndexEntry));
+
+	_output_stream.seekp(_header_position);
+	_output_stream.write((const char *) &_header, sizeof(_header));
+	_output_stream.seekp(0, std::ios::end);
+
+	_output_stream.flush();
+
+	_closed = true;
+}
+
+FrameReader::FrameReader(const char *file_name) : _input_stream(file_name, std::ios::binary)
+{
+	if (!_input_stream.is_open())
+	{
+		std::cerr << "[ERROR] Could not open frame file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	_input_stream.read((char *) &_header, sizeof(_header));
+
+	if (_input_stream.fail() || std::memcmp(_header.magic, FRAME_FILE_MAGIC, sizeof(FRAME_FILE_MAGIC)) != 0)
+	{
+		std::cerr << "[ERROR] Not a frame file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	if (_header.version != FRAME_FILE_VERSION)
+	{
+		std::cerr << "[ERROR] Frame file " << file_name << " has version " << _header.version;
+		std::cerr << ", expected version " << FRAME_FILE_VERSION << std::endl;
+		std::abort();
+	}
+
+	if (_header.value_size != getFrameDataTypeSize((FrameDataType) _header.data_type))
+	{
+		std::cerr << "[ERROR] Frame file " << file_name << " stores " << _header.value_size;
+		std::cerr << " byte values, which this build cannot read" << std::endl;
+		std::abort();
+	}
+
+	_quantity		= readString(_input_stream);
+	_quantity_units	= readString(_input_stream);
+	_grid_units		= readString(_input_stream);
+
+	std::streamoff position = _input_stream.tellg();
+	_input_stream.seekg((position + FRAME_FILE_ALIGNMENT - 1) / FRAME_FILE_ALIGNMENT * FRAME_FILE_ALIGNMENT);
+
+	_buffer.resize(_header.frame_size);
+	_grid_points.resize(_header.number_of_points);
+
+	_input_stream.read(_buffer.data(), _header.number_of_points * _header.value_size);
+	convertValues(_header.number_of_points, _buffer.data(), _grid_points.data());
+
+	if (_header.index_offset != 0)
+	{
+		_index.resize(_header.number_of_frames);
+
+		_input_stream.seekg(_header.index_offset);
+		_input_stream.read((char *) _index.data(), _index.size() * sizeof(FrameIndexEntry));
+	}
+
+	else
+	{
+		// Not closed, recover all complete frames
+		_input_stream.seekg(0, std::ios::end);
+
+		std::uint64_t number_of_frames = ((std::uint64_t) _input_stream.tellg() - _header.frames_offset) / _header.frame_size;
+
+		_index.resize(number_of_frames);
+
+		for (size_t i = 0; i < number_of_frames; i++)
+		{
+			real_t time = 0;
+
+			_index[i].offset = _header.frames_offset + i * _header.frame_size;
+
+			_input_stream.seekg(_index[i].offset);
+			_input_stream.read(_buffer.data(), _header.value_size);
+			convertValues(1, _buffer.data(), &time);
+
+			_index[i].time = time;
+		}
+	}
+
+	if (_input_stream.fail())
+	{
+		std::cerr << "[ERROR] Frame file is truncated - " << file_name << std::endl;
+		std::abort();
+	}
+}
+
+void FrameReader::convertValues(size_t number_of_values, const char *buffer, real_t *values) const
+{
+	convertFrameValues((FrameDataType) _header.data_type, number_of_values, buffer, values);
+}
+
+void FrameReader::readFrame(size_t frame_index, real_t &time, real_t *values)
+{
+	_input_stream.seekg(_index[frame_index].offset);
+	_input_stream.read(_buffer.data(), _buffer.size());
+
+	if (_input_stream.fail())
+	{
+		std::cerr << "[ERROR] Could not read frame # " << frame_index << std::endl;
+		std::abort();
+	}
+
+	convertValues(1, _buffer.data(), &time);
+	convertValues(_header.number_of_points, _buffer.data() + _header.value_size, values);
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/**
+ * @file Frame-Pyramid.cpp
+ * @brief Writes min / max decimated levels of a profile history
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Frame-Pyramid.hpp"
+
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#include <sys/stat.h>
+
+// Returns path of the frame file of level # level in directory
+inline std::string getLevelFileName(const std::string &directory, const char *format, size_t level)
+{
+	char file_name[32];
+	std::snprintf(file_name, sizeof(file_name), format, (unsigned int) level);
+
+	return directory + "/" + file_name;
+}
+
+PyramidProfileSink::PyramidProfileSink(
+	ProfileSink &full_resolution_sink,
+	const std::string &directory,
+	size_t number_of_levels,
+	size_t number_of_points,
+	const real_t *grid_points,
+	const char *quantity,
+	const char *quantity_units,
+	const char *grid_units,
+	FrameDataType data_type
+) :	_full_resolution_sink(full_resolution_sink),
+	_number_of_points(number_of_points)
+{
+	mkdir(directory.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+	for (size_t k = 1; k <= number_of_levels; k++)
+	{
+		Level * level = new Level;
+
+		level->factor = (size_t) 1 << k;
+
+		size_t number_of_blocks = (number_of_points + level->factor - 1) / level->factor;
+
+		std::vector<real_t> block_grid_points(number_of_blocks);
+
+		for (size_t j = 0; j < number_of_blocks; j++)
+		{
+			size_t last_point = std::min((j + 1) * level->factor, number_of_points) - 1;
+
+			block_grid_points[j] = 0.5 * (grid_points[j * level->factor] + grid_points[last_point]);
+		}
+
+		level->min_file.open(getLevelFileName(directory, PYRAMID_MIN_FILE_NAME_FORMAT, k).c_str(), std::ios::binary);
+		level->max_file.open(getLevelFileName(directory, PYRAMID_MAX_FILE_NAME_FORMAT, k).c_str(), std::ios::binary);
+
+		if (level->min_file.fail() || level->max_file.fail())
+		{
+			std::cerr << "[ERROR] Could not create level " << k << " of pyramid in " << directory << std::endl;
+			std::abort();
+		}
+
+		level->min_writer = new FrameWriter(level->min_file, number_of_blocks, block_grid_points.data(), quantity, quantity_units, grid_units, data_type);
+		level->max_writer = new FrameWriter(level->max_file, number_of_blocks, block_grid_points.data(), quantity, quantity_units, grid_units, data_type);
+
+		level->min_values.resize(number_of_blocks);
+		level->max_values.resize(number_of_blocks);
+
+		level->number_of_frames_in_block = 0;
+		level->block_time = 0;
+
+		_levels.push_back(level);
+	}
+}
+
+PyramidProfileSink::~PyramidProfileSink()
+{
+	for (size_t k = 0; k < _levels.size(); k++)
+	{
+		if (_levels[k]->number_of_frames_in_block > 0) writeBlock(*_levels[k]);
+
+		delete _levels[k]->min_writer;
+		delete _levels[k]->max_writer;
+
+		_levels[k]->min_file.close();
+		_levels[k]->max_file.close();
+
+		delete _levels[k];
+	}
+}
+
+void PyramidProfileSink::writeBlock(Level &level)
+{
+	level.min_writer->writeFrame(level.block_time, level.min_values.data());
+	level.max_writer->writeFrame(level.block_time, level.max_values.data());
+
+	level.number_of_frames_in_block = 0;
+}
+
+void PyramidProfileSink::writeProfile(real_t time, const real_t *values, size_t number_of_points)
+{
+	if (number_of_points != _number_of_points)
+	{
+		std::cerr << "[ERROR] Profile of " << number_of_points << " points written to pyramid of ";
+		std::cerr << _number_of_points << " points" << std::endl;
+		std::abort();
+	}
+
+	_full_resolution_sink.writeProfile(time, values, number_of_points);
+
+	for (size_t k = 0; k < _levels.size(); k++)
+	{
+		Level &level = *_levels[k];
+
+		bool first_frame = level.number_of_frames_in_block == 0;
+
+		if (first_frame) level.block_time = time;
+
+		for (size_t j = 0; j < level.min_values.size(); j++)
+		{
+			size_t end = std::min((j + 1) * level.factor, number_of_points);
+
+			real_t min_value = values[j * level.factor];
+			real_t max_value = values[j * level.factor];
+
+			for (size_t i = j * level.factor + 1; i < end; i++)
+			{
+				min_value = std::min(min_value, values[i]);
+				max_value = std::max(max_value, values[i]);
+			}
+
+			level.min_values[j] = first_frame ? min_value : std::min(level.min_values[j], min_value);
+			level.max_values[j] = first_frame ? max_value : std::max(level.max_values[j], max_value);
+		}
+
+		if (++level.number_of_frames_in_block == level.factor) writeBlock(level);
+	}
+}
+
+void PyramidProfileSink::flush()
+{
+	_full_resolution_sink.flush();
+
+	for (size_t k = 0; k < _levels.size(); k++)
+	{
+		_levels[k]->min_writer->flush();
+		_levels[k]->max_writer->flush();
+	}
+}
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "utilities/Keyboard-Interrupt.hpp"
 
 #include <csignal>
+#include <atomic>
 
 void throwInterruptException(int signal_code)
 {
@@ -26,4 +27,52 @@ void setUpKeyboardInterrupt()
     sigemptyset(&sig_int_handler.sa_mask);
     sig_int_handler.sa_flags = 0;
     sigaction(SIGINT, &sig_int_handler, NULL);
+}
+
+volatile std::sig_atomic_t interrupt_signal = 0;
+
+void recordInterruptSignal(int signal_code)
+{
+    interrupt_signal = signal_code;
+}
+
+void setUpInterruptFlag()
+{
+    sig_int_handler.sa_handler = recordInterruptSignal;
+    sigemptyset(&sig_int_handler.sa_mask);
+    sig_int_handler.sa_flags = 0;
+    sigaction(SIGINT, &sig_int_handler, NULL);
+    sigaction(SIGTERM, &sig_int_handler, NULL);
+}
+
+int getInterruptSignal()
+{
+    return interrupt_signal;
+}
+
+// Set in a signal handler, hence must not be implemented with a lock
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "Snapshot requests need lock free atomic flags");
+
+std::atomic<bool> snapshot_requested(false);
+
+struct sigaction sig_usr_handler;
+
+void recordSnapshotRequest(int)
+{
+    snapshot_requested.store(true, std::memory_order_relaxed);
+}
+
+void setUpSnapshotRequest()
+{
+    sig_usr_handler.sa_handler = recordSnapshotRequest;
+    sigemptyset(&sig_usr_handler.sa_mask);
+    sig_usr_handler.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &sig_usr_handler, NULL);
+}
+
+bool isSnapshotRequested()
+{
+    return
+        snapshot_requested.load(std::memory_order_relaxed) &&
+        snapshot_requested.exchange(false, std::memory_order_relaxed);
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+/**
+ * @file Memory-Usage.cpp
+ * @brief Reads resident memory of the process from /proc/self/status
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Memory-Usage.hpp"
+
+#include <fstream>
+#include <string>
+#include <sstream>
+
+// Returns bytes in field, given in kB, of /proc/self/status, 0 if not found
+static size_t readStatusField(const char *field)
+{
+	std::ifstream status_file("/proc/self/status");
+
+	std::string line;
+
+	while (std::getline(status_file, line))
+	{
+		if (line.compare(0, line.find(':'), field) != 0) continue;
+
+		std::istringstream value(line.substr(line.find(':') + 1));
+
+		size_t kilobytes = 0;
+		value >> kilobytes;
+
+		return kilobytes * 1024;
+	}
+
+	return 0;
+}
+
+size_t getResidentSetSize()
+{
+	return readStatusField("VmRSS");
+}
+
+size_t getPeakResidentSetSize()
+{
+	return readStatusField("VmHWM");
+}
\ No newline at end of file
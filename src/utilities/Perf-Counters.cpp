@@ -0,0 +1,166 @@
+/**
+ * @file Perf-Counters.cpp
+ * @brief Opens and reads per thread groups of hardware performance counters
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Perf-Counters.hpp"
+
+#include <iostream>
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+// Counters of a thread, opened as one group so that they count over the same intervals
+struct PerfCounterGroup
+{
+	int leader_file_descriptor;
+
+	// Counters in the order their values are read
+	int number_of_counters;
+	PerfCounter counters[NUMBER_OF_PERF_COUNTERS];
+};
+
+bool perf_counters_enabled = false;
+
+static std::uint64_t perf_raw_event = 0;
+
+static thread_local PerfCounterGroup * local_perf_counter_group = NULL;
+
+static const char * const PERF_COUNTER_NAMES[NUMBER_OF_PERF_COUNTERS] = {
+	"cycles",
+	"instructions",
+	"cache_misses",
+	"raw_event"
+};
+
+const char * getPerfCounterName(PerfCounter counter)
+{
+	return PERF_COUNTER_NAMES[counter];
+}
+
+// Returns file descriptor of counter on the calling thread in the group of
+// group_file_descriptor, or of a new group if it is -1, or -1 if it cannot be opened
+static int openPerfCounter(PerfCounter counter, int group_file_descriptor)
+{
+	struct perf_event_attr attributes;
+
+	std::memset(&attributes, 0, sizeof(attributes));
+
+	attributes.size				= sizeof(attributes);
+	attributes.exclude_kernel	= 1;
+	attributes.exclude_hv		= 1;
+	attributes.read_format		= PERF_FORMAT_GROUP;
+
+	switch (counter)
+	{
+		case PERF_CYCLES:
+
+			attributes.type		= PERF_TYPE_HARDWARE;
+			attributes.config	= PERF_COUNT_HW_CPU_CYCLES;
+			break;
+
+		case PERF_INSTRUCTIONS:
+
+			attributes.type		= PERF_TYPE_HARDWARE;
+			attributes.config	= PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+
+		case PERF_CACHE_MISSES:
+
+			attributes.type		= PERF_TYPE_HARDWARE;
+			attributes.config	= PERF_COUNT_HW_CACHE_MISSES;
+			break;
+
+		default:
+
+			if (perf_raw_event == 0) return -1;
+
+			attributes.type		= PERF_TYPE_RAW;
+			attributes.config	= perf_raw_event;
+	}
+
+	// Calling thread on any cpu
+	return syscall(SYS_perf_event_open, &attributes, 0, -1, group_file_descriptor, 0);
+}
+
+static PerfCounterGroup * openPerfCounterGroup()
+{
+	PerfCounterGroup * group = new PerfCounterGroup;
+
+	group->leader_file_descriptor = -1;
+	group->number_of_counters = 0;
+
+	for (int counter = 0; counter < NUMBER_OF_PERF_COUNTERS; counter++)
+	{
+		int file_descriptor = openPerfCounter((PerfCounter) counter, group->leader_file_descriptor);
+
+		if (file_descriptor < 0) continue;
+
+		if (group->leader_file_descriptor < 0) group->leader_file_descriptor = file_descriptor;
+
+		group->counters[group->number_of_counters++] = (PerfCounter) counter;
+	}
+
+	return group;
+}
+
+bool enablePerfCounters(std::uint64_t raw_event)
+{
+	perf_raw_event = raw_event;
+
+	local_perf_counter_group = openPerfCounterGroup();
+
+	if (local_perf_counter_group->number_of_counters == 0)
+	{
+		std::cerr << "[WARNING] Hardware performance counters are not available, ";
+		std::cerr << "check /proc/sys/kernel/perf_event_paranoid" << std::endl;
+
+		return false;
+	}
+
+	perf_counters_enabled = true;
+
+	return true;
+}
+
+bool isPerfCounterAvailable(PerfCounter counter)
+{
+	if (local_perf_counter_group == NULL) local_perf_counter_group = openPerfCounterGroup();
+
+	for (int i = 0; i < local_perf_counter_group->number_of_counters; i++)
+	{
+		if (local_perf_counter_group->counters[i] == counter) return true;
+	}
+
+	return false;
+}
+
+void readPerfCounters(PerfCounterValues &counter_values)
+{
+	std::memset(&counter_values, 0, sizeof(counter_values));
+
+	if (!perf_counters_enabled) return;
+
+	// Once per thread
+	if (local_perf_counter_group == NULL) local_perf_counter_group = openPerfCounterGroup();
+
+	const PerfCounterGroup &group = *local_perf_counter_group;
+
+	if (group.number_of_counters == 0) return;
+
+	// Number of counters followed by their values
+	std::uint64_t buffer[NUMBER_OF_PERF_COUNTERS + 1];
+
+	ssize_t size = read(group.leader_file_descriptor, buffer, sizeof(buffer));
+
+	if (size < (ssize_t) sizeof(std::uint64_t) || buffer[0] != (std::uint64_t) group.number_of_counters) return;
+
+	for (int i = 0; i < group.number_of_counters; i++) counter_values.values[group.counters[i]] = buffer[i + 1];
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+/**
+ * @file Phase-Timer.cpp
+ * @brief Accumulates and reports per thread wall time of solver phases
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Phase-Timer.hpp"
+#include "utilities/Memory-Usage.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Written only by the owning thread. Relaxed atomics compile to plain loads
+// and stores, and let other threads read the totals while phases are timed.
+typedef std::atomic<std::uint64_t> phase_count_t;
+
+struct PhaseTimes
+{
+	phase_count_t calls[NUMBER_OF_SOLVER_PHASES];
+	phase_count_t nanoseconds[NUMBER_OF_SOLVER_PHASES];
+
+	phase_count_t counters[NUMBER_OF_SOLVER_PHASES][NUMBER_OF_PERF_COUNTERS];
+};
+
+// Adds value to count of the calling thread
+static inline void addToCount(phase_count_t &count, std::uint64_t value)
+{
+	count.store(count.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+bool phase_timers_enabled = false;
+
+// Times of every thread that has timed a phase, in the order the threads first did so.
+// Never freed, so that times of threads that have exited are still reported.
+static std::vector<PhaseTimes *> thread_phase_times;
+static std::mutex thread_phase_times_mutex;
+
+static thread_local PhaseTimes * local_phase_times = NULL;
+
+static const char * const SOLVER_PHASE_NAMES[NUMBER_OF_SOLVER_PHASES] = {
+	"boundary_conditions",
+	"transient_term",
+	"heat_loss_term",
+	"pellet_solve",
+	"particle_update",
+	"thermal_conductivity",
+	"output"
+};
+
+const char * getSolverPhaseName(SolverPhase phase)
+{
+	return SOLVER_PHASE_NAMES[phase];
+}
+
+void enablePhaseTimers()
+{
+	phase_timers_enabled = true;
+}
+
+void addPhaseTime(SolverPhase phase, std::uint64_t nanoseconds, const PerfCounterValues *begin_counters)
+{
+	PerfCounterValues end_counters;
+
+	if (begin_counters != NULL) readPerfCounters(end_counters);
+
+	if (local_phase_times == NULL)
+	{
+		// Once per thread
+		local_phase_times = new PhaseTimes();
+
+		std::lock_guard<std::mutex> lock(thread_phase_times_mutex);
+		thread_phase_times.push_back(local_phase_times);
+	}
+
+	addToCount(local_phase_times->calls[phase], 1);
+	addToCount(local_phase_times->nanoseconds[phase], nanoseconds);
+
+	if (begin_counters == NULL) return;
+
+	for (int counter = 0; counter < NUMBER_OF_PERF_COUNTERS; counter++)
+	{
+		addToCount(local_phase_times->counters[phase][counter], end_counters.values[counter] - begin_counters->values[counter]);
+	}
+}
+
+// Returns true if counter is enabled and available, as
+// counters available on one thread are available on all threads
+static bool isPerfCounterReported(int counter)
+{
+	return perf_counters_enabled && isPerfCounterAvailable((PerfCounter) counter);
+}
+
+void getPhaseTimes(double *seconds)
+{
+	std::lock_guard<std::mutex> lock(thread_phase_times_mutex);
+
+	for (int phase = 0; phase < NUMBER_OF_SOLVER_PHASES; phase++)
+	{
+		std::uint64_t nanoseconds = 0;
+
+		for (size_t thread = 0; thread < thread_phase_times.size(); thread++)
+		{
+			nanoseconds += thread_phase_times[thread]->nanoseconds[phase].load(std::memory_order_relaxed);
+		}
+
+		seconds[phase] = nanoseconds * 1E-9;
+	}
+}
+
+void printPhaseProfileCSV(std::ostream &output_stream)
+{
+	std::lock_guard<std::mutex> lock(thread_phase_times_mutex);
+
+	output_stream << "phase,thread,calls,time";
+
+	for (int counter = 0; counter < NUMBER_OF_PERF_COUNTERS; counter++)
+	{
+		if (isPerfCounterReported(counter)) output_stream << ',' << getPerfCounterName((PerfCounter) counter);
+	}
+
+	output_stream << '\n';
+
+	for (int phase = 0; phase < NUMBER_OF_SOLVER_PHASES; phase++)
+	{
+		for (size_t thread = 0; thread < thread_phase_times.size(); thread++)
+		{
+			if (thread_phase_times[thread]->calls[phase] == 0) continue;
+
+			output_stream << SOLVER_PHASE_NAMES[phase] << ',' << thread << ',';
+			output_stream << thread_phase_times[thread]->calls[phase] << ',';
+			output_stream << thread_phase_times[thread]->nanoseconds[phase] * 1E-9;
+
+			for (int counter = 0; counter < NUMBER_OF_PERF_COUNTERS; counter++)
+			{
+				if (isPerfCounterReported(counter)) output_stream << ',' << thread_phase_times[thread]->counters[phase][counter];
+			}
+
+			output_stream << '\n';
+		}
+	}
+}
+
+void printPhaseProfileJSON(std::ostream &output_stream, double wall_time)
+{
+	std::lock_guard<std::mutex> lock(thread_phase_times_mutex);
+
+	output_stream << "{\n\t\"wall_time\": " << wall_time << ",\n";
+	output_stream << "\t\"threads\": " << thread_phase_times.size() << ",\n";
+
+	// Resident memory in bytes when written and at its largest
+	output_stream << "\t\"rss\": " << getResidentSetSize() << ",\n";
+	output_stream << "\t\"peak_rss\": " << getPeakResidentSetSize() << ",\n";
+	output_stream << "\t\"phases\": [";
+
+	bool first_phase = true;
+
+	for (int phase = 0; phase < NUMBER_OF_SOLVER_PHASES; phase++)
+	{
+		std::uint64_t calls = 0, nanoseconds = 0, max_nanoseconds = 0;
+
+		for (size_t thread = 0; thread < thread_phase_times.size(); thread++)
+		{
+			calls		+= thread_phase_times[thread]->calls[phase];
+			nanoseconds	+= thread_phase_times[thread]->nanoseconds[phase];
+
+			if (thread_phase_times[thread]->nanoseconds[phase] > max_nanoseconds) max_nanoseconds = thread_phase_times[thread]->nanoseconds[phase];
+		}
+
+		if (calls == 0) continue;
+
+		output_stream << (first_phase ? "\n" : ",\n");
+		first_phase = false;
+
+		output_stream << "\t\t{\n\t\t\t\"name\": \"" << SOLVER_PHASE_NAMES[phase] << "\",\n";
+		output_stream << "\t\t\t\"calls\": " << calls << ",\n";
+		output_stream << "\t\t\t\"time\": " << nanoseconds * 1E-9 << ",\n";
+
+		// Time of the busiest thread, which bounds the phase in parallel regions
+		output_stream << "\t\t\t\"max_thread_time\": " << max_nanoseconds * 1E-9 << ",\n";
+
+		output_stream << "\t\t\t\"thread_times\": [";
+
+		for (size_t thread = 0; thread < thread_phase_times.size(); thread++)
+		{
+			output_stream << (thread == 0 ? "" : ", ") << thread_phase_times[thread]->nanoseconds[phase] * 1E-9;
+		}
+
+		output_stream << "]";
+
+		for (int counter = 0; counter < NUMBER_OF_PERF_COUNTERS; counter++)
+		{
+			if (!isPerfCounterReported(counter)) continue;
+
+			std::uint64_t count = 0;
+
+			for (size_t thread = 0; thread < thread_phase_times.size(); thread++) count += thread_phase_times[thread]->counters[phase][counter];
+
+			output_stream << ",\n\t\t\t\"" << getPerfCounterName((PerfCounter) counter) << "\": " << count << ",\n";
+			output_stream << "\t\t\t\"thread_" << getPerfCounterName((PerfCounter) counter) << "\": [";
+
+			for (size_t thread = 0; thread < thread_phase_times.size(); thread++)
+			{
+				output_stream << (thread == 0 ? "" : ", ") << thread_phase_times[thread]->counters[phase][counter];
+			}
+
+			output_stream << "]";
+		}
+
+		output_stream << "\n\t\t}";
+	}
+
+	output_stream << "\n\t]\n}\n";
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+ * @file Profile-Formatter.cpp
+ * @brief Formats profiles using std::to_chars
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Profile-Formatter.hpp"
+
+#include <atomic>
+#include <charconv>
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+static std::atomic<int> significant_digits(DEFAULT_SIGNIFICANT_DIGITS);
+
+void setSignificantDigits(int digits)
+{
+	if (digits < 0 || digits > MAX_SIGNIFICANT_DIGITS)
+	{
+		std::cerr << "[ERROR] Significant digits should be between 0 and " << MAX_SIGNIFICANT_DIGITS << ". Given " << digits << std::endl;
+		std::abort();
+	}
+
+	significant_digits = digits;
+}
+
+int getSignificantDigits()
+{
+	return significant_digits;
+}
+
+// Returns upper bound on characters of a value formatted with digits significant digits,
+// 0 for the shortest exact representation, and a delimiter. Besides the digits, a value
+// holds at most a sign, a decimal point, an exponent like e-4951 and leading zeros like 0.000
+inline size_t getMaxCharsPerValue(int digits)
+{
+	return (digits > 0 ? digits : MAX_SIGNIFICANT_DIGITS) + 10;
+}
+
+inline char * formatValue(char *first, char *last, real_t value, int digits)
+{
+	std::to_chars_result result = digits > 0 ?
+		std::to_chars(first, last, value, std::chars_format::general, digits) :
+		std::to_chars(first, last, value);
+
+	if (result.ec != std::errc())
+	{
+		std::cerr << "[ERROR] Could not format " << value << " with " << digits << " significant digits" << std::endl;
+		std::abort();
+	}
+
+	return result.ptr;
+}
+
+void printProfile(
+	std::ostream &output_stream,
+	real_t first_value,
+	const real_t *values,
+	size_t number_of_values,
+	char delimiter
+) {
+	// Grows to the longest row formatted by this thread and is reused afterwards
+	thread_local std::vector<char> buffer;
+
+	int digits = significant_digits;
+
+	// The last value is followed by a new line instead of a delimiter
+	size_t required_size = (number_of_values + 1) * getMaxCharsPerValue(digits);
+
+	if (buffer.size() < required_size) buffer.resize(required_size);
+
+	char *position = buffer.data();
+	char *last = buffer.data() + buffer.size();
+
+	position = formatValue(position, last, first_value, digits);
+
+	for (size_t i = 0; i < number_of_values; i++)
+	{
+		*position++ = delimiter;
+		position = formatValue(position, last, values[i], digits);
+	}
+
+	*position++ = '\n';
+
+	output_stream.write(buffer.data(), position - buffer.data());
+}
\ No newline at end of file
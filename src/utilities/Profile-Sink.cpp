@@ -0,0 +1,29 @@
+/**
+ * @file Profile-Sink.cpp
+ * @brief Defines the CSV destination of time stamped profiles
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Profile-Sink.hpp"
+#include "utilities/Profile-Formatter.hpp"
+
+CSVProfileSink::CSVProfileSink(
+	std::ostream &output_stream,
+	char delimiter
+) :	_output_stream(output_stream),
+	_delimiter(delimiter)
+{ ; }
+
+void CSVProfileSink::writeProfile(real_t time, const real_t *values, size_t number_of_points)
+{
+	printProfile(_output_stream, time, values, number_of_points, _delimiter);
+}
+
+void CSVProfileSink::flush()
+{
+	_output_stream.flush();
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "utilities/Program-Options.hpp"
 #include "utilities/Read-Data.hpp"
+#include "utilities/Profile-Formatter.hpp"
 #include <iostream>
+#include <cstdlib>
 
 void setHelpOption(ez::ezOptionParser &opt)
 {
@@ -141,5 +143,1042 @@ double getIgnitionLengthOption(ez::ezOptionParser &opt, double default_value)
 		std::cout << "Ignition Length Fraction of Pellet is set to " << default_value << "\n";
 	}
 
+	return default_value;
+}
+
+void setDataDirectoryOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"data",
+		0,
+		1,
+		0,
+		"Set directory containing the input data files to ARG.",
+		"-data"
+	);
+}
+
+std::string getDataDirectoryOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-data"))
+	{
+		opt.get("-data")->getString(default_value);
+		std::cout << "Data directory is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setDatabaseFileOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"property-database.bin",
+		0,
+		1,
+		0,
+		"Set compiled property database file to ARG.",
+		"-db"
+	);
+}
+
+std::string getDatabaseFileOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-db"))
+	{
+		opt.get("-db")->getString(default_value);
+		std::cout << "Property database file is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setPhiListOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0.7",
+		0,
+		-1,
+		',',
+		"Set comma separated list of Particle Volume Fractions of Pellet to ARG.",
+		"-phi-list"
+	);
+}
+
+std::vector<double> getPhiListOption(ez::ezOptionParser &opt, std::vector<double> default_value)
+{
+	if (opt.isSet("-phi-list"))
+	{
+		// Parsed values are appended to the vector
+		default_value.clear();
+		opt.get("-phi-list")->getDoubles(default_value);
+
+		for (size_t i = 0; i < default_value.size(); i++)
+		{
+			if (default_value[i] <= 0 || default_value[i] >= 1)
+			{
+				std::cerr << "Particle Volume Fraction should be in (0,1). Given " << default_value[i] << "\n";
+				std::abort();
+			}
+		}
+
+		std::cout << "Sweeping " << default_value.size() << " Particle Volume Fractions of Pellet\n";
+	}
+
+	return default_value;
+}
+
+void setIgnitionTemperatureListOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"1500.0",
+		0,
+		-1,
+		',',
+		"Set comma separated list of Initial Pellet Ignition Temperatures to ARG K.",
+		"-ignT-list"
+	);
+}
+
+std::vector<double> getIgnitionTemperatureListOption(ez::ezOptionParser &opt, std::vector<double> default_value)
+{
+	// Validated against the critical temperature of each diffusivity model by the caller
+	if (opt.isSet("-ignT-list"))
+	{
+		// Parsed values are appended to the vector
+		default_value.clear();
+		opt.get("-ignT-list")->getDoubles(default_value);
+
+		std::cout << "Sweeping " << default_value.size() << " Initial Pellet Ignition Temperatures\n";
+	}
+
+	return default_value;
+}
+
+void setIgnitionLengthListOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0.1",
+		0,
+		-1,
+		',',
+		"Set comma separated list of Initial Ignition Length Fractions of Pellet to ARG.",
+		"-ignL-list"
+	);
+}
+
+std::vector<double> getIgnitionLengthListOption(ez::ezOptionParser &opt, std::vector<double> default_value)
+{
+	if (opt.isSet("-ignL-list"))
+	{
+		// Parsed values are appended to the vector
+		default_value.clear();
+		opt.get("-ignL-list")->getDoubles(default_value);
+
+		for (size_t i = 0; i < default_value.size(); i++)
+		{
+			if (default_value[i] <= 0 || default_value[i] >= 1)
+			{
+				std::cerr << "Pellet Length Fraction should be in (0,1). Given " << default_value[i] << "\n";
+				std::abort();
+			}
+		}
+
+		std::cout << "Sweeping " << default_value.size() << " Ignition Length Fractions of Pellet\n";
+	}
+
+	return default_value;
+}
+
+void setDiffusivityListOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"data/core-shell-particle/diffusivity-parameters",
+		0,
+		-1,
+		',',
+		"Set comma separated list of diffusivity parameter directories to ARG.",
+		"-diffusivity-list"
+	);
+}
+
+std::vector<std::string> getDiffusivityListOption(ez::ezOptionParser &opt, std::vector<std::string> default_value)
+{
+	if (opt.isSet("-diffusivity-list"))
+	{
+		// Parsed values are appended to the vector
+		default_value.clear();
+		opt.get("-diffusivity-list")->getStrings(default_value);
+
+		std::cout << "Sweeping " << default_value.size() << " diffusivity parameter sets\n";
+	}
+
+	return default_value;
+}
+
+void setCasesFileOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		1,
+		0,
+		"Read cases from file ARG, one case per line as phi,ignT,ignL,diffusivity-directory.",
+		"-cases"
+	);
+}
+
+std::string getCasesFileOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-cases"))
+	{
+		opt.get("-cases")->getString(default_value);
+		std::cout << "Cases file is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setCaseThreadsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Set number of cases solved concurrently to ARG.",
+		"-case-threads"
+	);
+}
+
+int getCaseThreadsOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-case-threads"))
+	{
+		opt.get("-case-threads")->getInt(default_value);
+
+		if (default_value < 1)
+		{
+			std::cerr << "Number of concurrent cases should be at least 1. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Number of concurrent cases is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setNodeThreadsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Set number of threads solving the grid points of each case to ARG.",
+		"-node-threads"
+	);
+}
+
+int getNodeThreadsOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-node-threads"))
+	{
+		opt.get("-node-threads")->getInt(default_value);
+
+		if (default_value < 1)
+		{
+			std::cerr << "Number of threads per case should be at least 1. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Number of threads per case is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setMaxTimeOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"1.0",
+		0,
+		1,
+		0,
+		"Set maximum simulated time of each case to ARG s.",
+		"-tmax"
+	);
+}
+
+double getMaxTimeOption(ez::ezOptionParser &opt, double default_value)
+{
+	if (opt.isSet("-tmax"))
+	{
+		opt.get("-tmax")->getDouble(default_value);
+
+		if (default_value <= 0)
+		{
+			std::cerr << "Maximum simulated time should be positive. Given " << default_value << " s\n";
+			std::abort();
+		}
+
+		std::cout << "Maximum simulated time is set to " << default_value << " s\n";
+	}
+
+	return default_value;
+}
+
+void setOutputFormatOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"csv",
+		0,
+		1,
+		0,
+		"Set format of the solution files to ARG, either csv, binary, chunked or compressed.",
+		"-output-format"
+	);
+}
+
+std::string getOutputFormatOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-output-format"))
+	{
+		opt.get("-output-format")->getString(default_value);
+
+		if (default_value != "csv" && default_value != "binary" && default_value != "chunked" && default_value != "compressed")
+		{
+			std::cerr << "Output format should be csv, binary, chunked or compressed. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Output format is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setInputFileOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		1,
+		0,
+		"Set input file to ARG.",
+		"-i"
+	);
+}
+
+std::string getInputFileOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-i"))
+	{
+		opt.get("-i")->getString(default_value);
+	}
+
+	return default_value;
+}
+
+void setOutputFileOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		1,
+		0,
+		"Set output file to ARG.",
+		"-o"
+	);
+}
+
+std::string getOutputFileOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-o"))
+	{
+		opt.get("-o")->getString(default_value);
+	}
+
+	return default_value;
+}
+
+void setChunkFramesOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"1000",
+		0,
+		1,
+		0,
+		"Set number of frames in each chunk of chunked solution files to ARG.",
+		"-chunk-frames"
+	);
+}
+
+int getChunkFramesOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-chunk-frames"))
+	{
+		opt.get("-chunk-frames")->getInt(default_value);
+
+		if (default_value <= 0)
+		{
+			std::cerr << "Frames per chunk should be positive. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Frames per chunk are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setPyramidLevelsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Set number of min / max decimated levels written alongside solution files to ARG.",
+		"-pyramid-levels"
+	);
+}
+
+int getPyramidLevelsOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-pyramid-levels"))
+	{
+		opt.get("-pyramid-levels")->getInt(default_value);
+
+		if (default_value < 0 || default_value > 16)
+		{
+			std::cerr << "Pyramid levels should be in [0,16]. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Pyramid levels are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setSignificantDigitsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"6",
+		0,
+		1,
+		0,
+		"Set significant digits of values in CSV files to ARG, at most 21, 0 for shortest exact representation.",
+		"-digits"
+	);
+}
+
+int getSignificantDigitsOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-digits"))
+	{
+		opt.get("-digits")->getInt(default_value);
+
+		if (default_value < 0 || default_value > MAX_SIGNIFICANT_DIGITS)
+		{
+			std::cerr << "Significant digits should be between 0 and " << MAX_SIGNIFICANT_DIGITS << ". Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Significant digits are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setRestartFileOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		1,
+		0,
+		"Resume the simulation from checkpoint file ARG.",
+		"-restart"
+	);
+}
+
+std::string getRestartFileOption(ez::ezOptionParser &opt, std::string default_value)
+{
+	if (opt.isSet("-restart"))
+	{
+		opt.get("-restart")->getString(default_value);
+
+		std::cout << "Restarting from checkpoint " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setCheckpointIntervalOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"600",
+		0,
+		1,
+		0,
+		"Set interval between checkpoints to ARG s of runtime, 0 to checkpoint only when stopped by a signal.",
+		"-checkpoint-interval"
+	);
+}
+
+double getCheckpointIntervalOption(ez::ezOptionParser &opt, double default_value)
+{
+	if (opt.isSet("-checkpoint-interval"))
+	{
+		opt.get("-checkpoint-interval")->getDouble(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Checkpoint interval should be non-negative. Given " << default_value << " s\n";
+			std::abort();
+		}
+
+		std::cout << "Checkpoint interval is set to " << default_value << " s\n";
+	}
+
+	return default_value;
+}
+
+void setSteadyToleranceOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Stop once the flame speed is steady, that is its relative change over the window stays below ARG. 0 to run until combustion is complete.",
+		"-steady-tol"
+	);
+}
+
+double getSteadyToleranceOption(ez::ezOptionParser &opt, double default_value)
+{
+	if (opt.isSet("-steady-tol"))
+	{
+		opt.get("-steady-tol")->getDouble(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Steady flame speed tolerance should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Steady flame speed tolerance is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setSteadyWindowOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0.01",
+		0,
+		1,
+		0,
+		"Set the window over which the flame speed and its change are evaluated to ARG s.",
+		"-steady-window"
+	);
+}
+
+double getSteadyWindowOption(ez::ezOptionParser &opt, double default_value)
+{
+	if (opt.isSet("-steady-window"))
+	{
+		opt.get("-steady-window")->getDouble(default_value);
+
+		if (default_value <= 0)
+		{
+			std::cerr << "Steady flame speed window should be positive. Given " << default_value << " s\n";
+			std::abort();
+		}
+
+		std::cout << "Steady flame speed window is set to " << default_value << " s\n";
+	}
+
+	return default_value;
+}
+
+void setSteadyDurationOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0.02",
+		0,
+		1,
+		0,
+		"Set the time for which the flame speed must stay steady before stopping to ARG s.",
+		"-steady-duration"
+	);
+}
+
+double getSteadyDurationOption(ez::ezOptionParser &opt, double default_value)
+{
+	if (opt.isSet("-steady-duration"))
+	{
+		opt.get("-steady-duration")->getDouble(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Steady flame speed duration should be non-negative. Given " << default_value << " s\n";
+			std::abort();
+		}
+
+		std::cout << "Steady flame speed duration is set to " << default_value << " s\n";
+	}
+
+	return default_value;
+}
+
+void setProfileOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		0,
+		0,
+		"Time the phases of the solver and write the profile to profile.json and profile.csv.",
+		"-profile"
+	);
+}
+
+bool getProfileOption(ez::ezOptionParser &opt)
+{
+	if (opt.isSet("-profile"))
+	{
+		std::cout << "Profiling solver phases\n";
+
+		return true;
+	}
+
+	return false;
+}
+
+void setPerfCountersOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		0,
+		0,
+		"Count hardware events in the phases of the solver with perf_event_open and add them to the profile. Implies -profile.",
+		"-perf-counters"
+	);
+}
+
+bool getPerfCountersOption(ez::ezOptionParser &opt)
+{
+	if (opt.isSet("-perf-counters"))
+	{
+		std::cout << "Counting hardware events in solver phases\n";
+
+		return true;
+	}
+
+	return false;
+}
+
+void setPerfRawEventOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Also count the model specific hardware event with raw code ARG, for example 0x1eca, with -perf-counters.",
+		"-perf-raw-event"
+	);
+}
+
+unsigned long long getPerfRawEventOption(ez::ezOptionParser &opt, unsigned long long default_value)
+{
+	if (opt.isSet("-perf-raw-event"))
+	{
+		std::string code;
+		opt.get("-perf-raw-event")->getString(code);
+
+		// Decimal, or hexadecimal with 0x
+		char * end;
+		default_value = std::strtoull(code.c_str(), &end, 0);
+
+		if (code.empty() || *end != '\0')
+		{
+			std::cerr << "Raw hardware event should be an integer code. Given " << code << "\n";
+			std::abort();
+		}
+
+		std::cout << "Raw hardware event is set to " << code << "\n";
+	}
+
+	return default_value;
+}
+
+void setTraceOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Record a timeline of the last ARG events of each thread and write it to trace.json, 0 to not trace.",
+		"-trace"
+	);
+}
+
+int getTraceOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-trace"))
+	{
+		opt.get("-trace")->getInt(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Trace events per thread should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Trace events per thread are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setNodeCostsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		0,
+		0,
+		"Write the time spent on each grid point in every output interval to node-cost-*.csv.",
+		"-node-costs"
+	);
+}
+
+bool getNodeCostsOption(ez::ezOptionParser &opt)
+{
+	if (opt.isSet("-node-costs"))
+	{
+		std::cout << "Timing grid points\n";
+
+		return true;
+	}
+
+	return false;
+}
+
+void setMemoryBudgetOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Refuse to start if the pellet would need more than ARG GB of memory, 0 for no limit.",
+		"-memory-budget"
+	);
+}
+
+double getMemoryBudgetOption(ez::ezOptionParser &opt, double default_value)
+{
+	if (opt.isSet("-memory-budget"))
+	{
+		opt.get("-memory-budget")->getDouble(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Memory budget should be non-negative. Given " << default_value << " GB\n";
+			std::abort();
+		}
+
+		std::cout << "Memory budget is set to " << default_value << " GB\n";
+	}
+
+	return default_value;
+}
+
+void setPinThreadsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		0,
+		0,
+		"Pin each thread solving the grid points to its own CPU.",
+		"-pin-threads"
+	);
+}
+
+bool getPinThreadsOption(ez::ezOptionParser &opt)
+{
+	if (opt.isSet("-pin-threads"))
+	{
+		std::cout << "Pinning threads to CPUs\n";
+
+		return true;
+	}
+
+	return false;
+}
+
+void setBenchmarkNodesOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"1001",
+		0,
+		1,
+		0,
+		"Set number of grid points of the benchmark to ARG.",
+		"-nodes"
+	);
+}
+
+int getBenchmarkNodesOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-nodes"))
+	{
+		opt.get("-nodes")->getInt(default_value);
+
+		if (default_value < 3)
+		{
+			std::cerr << "Number of grid points should be at least 3. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Number of grid points is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setBenchmarkIterationsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"10000",
+		0,
+		1,
+		0,
+		"Set number of iterations of the benchmark to ARG.",
+		"-iterations"
+	);
+}
+
+int getBenchmarkIterationsOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-iterations"))
+	{
+		opt.get("-iterations")->getInt(default_value);
+
+		if (default_value <= 0)
+		{
+			std::cerr << "Number of iterations should be positive. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Number of iterations is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setBenchmarkWorkOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Set arithmetic operations per grid point between writes in the benchmark to ARG.",
+		"-work"
+	);
+}
+
+int getBenchmarkWorkOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-work"))
+	{
+		opt.get("-work")->getInt(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Operations per grid point should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Operations per grid point are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setBenchmarkReactingNodesOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"32",
+		0,
+		1,
+		0,
+		"Set number of consecutive reacting grid points in the middle of the benchmark to ARG.",
+		"-reacting-nodes"
+	);
+}
+
+int getBenchmarkReactingNodesOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-reacting-nodes"))
+	{
+		opt.get("-reacting-nodes")->getInt(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Number of reacting grid points should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Number of reacting grid points is set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setBenchmarkReactingWorkOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"10000",
+		0,
+		1,
+		0,
+		"Set arithmetic operations per reacting grid point between writes in the benchmark to ARG.",
+		"-reacting-work"
+	);
+}
+
+int getBenchmarkReactingWorkOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-reacting-work"))
+	{
+		opt.get("-reacting-work")->getInt(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Operations per reacting grid point should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Operations per reacting grid point are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setSpeciesTasksOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"10000",
+		0,
+		1,
+		0,
+		"Solve species of particles with at least ARG grid points concurrently when few grid points are reacting, 0 to never.",
+		"-species-tasks"
+	);
+}
+
+int getSpeciesTasksOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-species-tasks"))
+	{
+		opt.get("-species-tasks")->getInt(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Particle grid points for concurrent species should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+
+		std::cout << "Particle grid points for concurrent species are set to " << default_value << "\n";
+	}
+
+	return default_value;
+}
+
+void setTaskPipelineOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		0,
+		0,
+		"Set up and solve each iteration as a graph of tasks, updating particles while the pellet equations are still solved.",
+		"-task-pipeline"
+	);
+}
+
+bool getTaskPipelineOption(ez::ezOptionParser &opt)
+{
+	if (opt.isSet("-task-pipeline"))
+	{
+		std::cout << "Solving iterations as task graphs\n";
+
+		return true;
+	}
+
+	return false;
+}
+
+void setMetricsOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"",
+		0,
+		0,
+		0,
+		"Publish progress of the solver to metrics.bin in the solution folder, read by Pellet-Metrics-Monitor.",
+		"-metrics"
+	);
+}
+
+bool getMetricsOption(ez::ezOptionParser &opt)
+{
+	if (opt.isSet("-metrics"))
+	{
+		std::cout << "Publishing solver metrics\n";
+
+		return true;
+	}
+
+	return false;
+}
+
+void setWatchOption(ez::ezOptionParser &opt)
+{
+	opt.add(
+		"0",
+		0,
+		1,
+		0,
+		"Display metrics again every ARG seconds, 0 to display them once.",
+		"-watch"
+	);
+}
+
+int getWatchOption(ez::ezOptionParser &opt, int default_value)
+{
+	if (opt.isSet("-watch"))
+	{
+		opt.get("-watch")->getInt(default_value);
+
+		if (default_value < 0)
+		{
+			std::cerr << "Watch interval should be non-negative. Given " << default_value << "\n";
+			std::abort();
+		}
+	}
+
 	return default_value;
 }
\ No newline at end of file
@@ -0,0 +1,395 @@
+/**
+ * @file Property-Database.cpp
+ * @brief Compiles and memory maps the binary property database
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Property-Database.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static const char PROPERTY_DATABASE_MAGIC[8] = {'P', 'E', 'L', 'L', 'E', 'T', 'D', 'B'};
+
+// 64 bit FNV-1a hash of the payload
+std::uint64_t calcChecksum(const char *data, size_t size)
+{
+	std::uint64_t hash = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= (unsigned char) data[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+// Paths are resolved lexically, symbolic links are not followed
+std::string normalizeDataPath(const char *directory_name, const char *file_name)
+{
+	std::string path;
+
+	if (directory_name[0] != '/')
+	{
+		char working_directory[_POSIX_PATH_MAX];
+
+		if (getcwd(working_directory, sizeof(working_directory)) == NULL)
+		{
+			std::cerr << "[ERROR] Could not get working directory" << std::endl;
+			std::abort();
+		}
+
+		path.append(working_directory);
+		path.append("/");
+	}
+
+	path.append(directory_name);
+
+	if (file_name[0] != '\0')
+	{
+		path.append("/");
+		path.append(file_name);
+	}
+
+	std::string normalized_path;
+
+	for (size_t begin = 0; begin < path.length();)
+	{
+		size_t end = path.find('/', begin);
+
+		if (end == std::string::npos) end = path.length();
+
+		std::string component = path.substr(begin, end - begin);
+
+		begin = end + 1;
+
+		if (component.empty() || component == ".") continue;
+
+		// Every component of normalized_path begins with '/'
+		if (component == "..")
+		{
+			size_t separator = normalized_path.rfind('/');
+
+			if (separator != std::string::npos) normalized_path.erase(separator);
+
+			continue;
+		}
+
+		normalized_path.append("/");
+		normalized_path.append(component);
+	}
+
+	if (normalized_path.empty()) normalized_path = "/";
+
+	return normalized_path;
+}
+
+PropertyDatabase::PropertyDatabase(const char *file_name, const char *data_root) : _data_root(normalizeDataPath(data_root))
+{
+	int file_descriptor = open(file_name, O_RDONLY);
+
+	struct stat file_status;
+
+	if (file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0)
+	{
+		std::cerr << "[ERROR] Could not open property database - " << file_name << std::endl;
+		std::abort();
+	}
+
+	_mapped_size = file_status.st_size;
+
+	if (_mapped_size < sizeof(Header))
+	{
+		std::cerr << "[ERROR] Property database is truncated - " << file_name << std::endl;
+		std::abort();
+	}
+
+	_mapped_memory = mmap(NULL, _mapped_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+	close(file_descriptor);
+
+	if (_mapped_memory == MAP_FAILED)
+	{
+		std::cerr << "[ERROR] Could not memory map property database - " << file_name << std::endl;
+		std::abort();
+	}
+
+	_header		= (const Header *) _mapped_memory;
+	_payload	= (const char *) _mapped_memory + sizeof(Header);
+	_entries	= (const Entry *) _payload;
+
+	if (std::memcmp(_header->magic, PROPERTY_DATABASE_MAGIC, sizeof(PROPERTY_DATABASE_MAGIC)) != 0)
+	{
+		std::cerr << "[ERROR] Not a property database - " << file_name << std::endl;
+		std::abort();
+	}
+
+	if (_header->version != PROPERTY_DATABASE_VERSION || _header->real_size != sizeof(real_t))
+	{
+		std::cerr << "[ERROR] Property database " << file_name << " has version " << _header->version;
+		std::cerr << " and real size " << _header->real_size << " bytes, expected version " << PROPERTY_DATABASE_VERSION;
+		std::cerr << " and real size " << sizeof(real_t) << " bytes. Recompile the database." << std::endl;
+		std::abort();
+	}
+
+	if (
+		_header->payload_size != _mapped_size - sizeof(Header) ||
+		calcChecksum(_payload, _header->payload_size) != _header->checksum
+	) {
+		std::cerr << "[ERROR] Property database is corrupted, checksum mismatch - " << file_name << std::endl;
+		std::abort();
+	}
+}
+
+PropertyDatabase::~PropertyDatabase()
+{
+	munmap(_mapped_memory, _mapped_size);
+}
+
+const PropertyDatabase::Entry * PropertyDatabase::findEntry(const std::string &key) const
+{
+	for (std::uint64_t i = 0; i < _header->number_of_entries; i++)
+	{
+		if (
+			_entries[i].key_length == key.length() &&
+			std::memcmp(_payload + _entries[i].key_offset, key.data(), key.length()) == 0
+		) return _entries + i;
+	}
+
+	return NULL;
+}
+
+bool PropertyDatabase::getKey(const char *directory_name, const char *file_name, std::string &key) const
+{
+	std::string path = normalizeDataPath(directory_name, file_name);
+
+	if (path == _data_root)
+	{
+		key.clear();
+		return true;
+	}
+
+	// The root itself is never a key, "/" is the only root ending with '/'
+	std::string prefix = _data_root == "/" ? _data_root : _data_root + "/";
+
+	if (path.compare(0, prefix.length(), prefix) != 0) return false;
+
+	key = path.substr(prefix.length());
+
+	return true;
+}
+
+const real_t * PropertyDatabase::getValues(
+	const char *directory_name,
+	const char *file_name,
+	size_t &number_of_values
+) const {
+	std::string key;
+
+	if (!getKey(directory_name, file_name, key)) return NULL;
+
+	const Entry * entry = findEntry(key);
+
+	if (entry == NULL) return NULL;
+
+	number_of_values = entry->number_of_values;
+
+	return (const real_t *) (_payload + entry->values_offset);
+}
+
+std::vector<std::string> PropertyDatabase::getSubDirectories(const char *directory_name) const
+{
+	std::vector<std::string> sub_directories;
+
+	std::string prefix;
+
+	if (!getKey(directory_name, "", prefix)) return sub_directories;
+
+	if (!prefix.empty()) prefix.append("/");
+
+	for (std::uint64_t i = 0; i < _header->number_of_entries; i++)
+	{
+		std::string key(_payload + _entries[i].key_offset, _entries[i].key_length);
+
+		if (key.compare(0, prefix.length(), prefix) != 0) continue;
+
+		size_t separator = key.find('/', prefix.length());
+
+		if (separator == std::string::npos) continue;
+
+		std::string sub_directory = key.substr(prefix.length(), separator - prefix.length());
+
+		bool listed = false;
+
+		for (size_t j = 0; j < sub_directories.size() && !listed; j++) listed = sub_directories[j] == sub_directory;
+
+		if (!listed) sub_directories.push_back(sub_directory);
+	}
+
+	return sub_directories;
+}
+
+const PropertyDatabase * PropertyDatabase::getLoadedDatabase()
+{
+	// Loaded on first use, irrespective of the order of static initialization
+	static const char * file_name = std::getenv(PROPERTY_DATABASE_ENVIRONMENT_VARIABLE);
+	static const char * data_root = std::getenv(PROPERTY_DATABASE_ROOT_ENVIRONMENT_VARIABLE);
+
+	static const PropertyDatabase * database = file_name != NULL && file_name[0] != '\0' ?
+		new PropertyDatabase(file_name, data_root != NULL && data_root[0] != '\0' ? data_root : PROPERTY_DATABASE_DEFAULT_ROOT) :
+		NULL;
+
+	return database;
+}
+
+struct CompiledFile
+{
+	std::string key;
+	std::vector<real_t> values;
+};
+
+// Returns true if the entry at path is a directory. Some file systems do not
+// report the type of entries in d_type, they are then looked up with stat.
+inline bool isDirectory(const dirent *dirent_p, const std::string &path)
+{
+	if (dirent_p->d_type != DT_UNKNOWN) return dirent_p->d_type == DT_DIR;
+
+	struct stat file_status;
+
+	return stat(path.c_str(), &file_status) == 0 && S_ISDIR(file_status.st_mode);
+}
+
+// Recursively collects the numeric *.txt files in directory_name in the order they
+// are listed by the file system, keyed by key_prefix followed by their file names
+void collectDataFiles(const std::string &directory_name, const std::string &key_prefix, std::vector<CompiledFile> &files)
+{
+	DIR* directory = opendir(directory_name.c_str());
+
+	if (directory == NULL)
+	{
+		std::cerr << "[ERROR] Could not open directory - " << directory_name << std::endl;
+		std::abort();
+	}
+
+	dirent* dirent_p;
+
+	while ((dirent_p = readdir(directory)) != NULL)
+	{
+		if (!std::strcmp(dirent_p->d_name, ".") || !std::strcmp(dirent_p->d_name, "..")) continue;
+
+		std::string path	= directory_name + "/" + dirent_p->d_name;
+		std::string key		= key_prefix + dirent_p->d_name;
+
+		if (isDirectory(dirent_p, path))
+		{
+			collectDataFiles(path, key + "/", files);
+			continue;
+		}
+
+		size_t length = key.length();
+
+		if (length < 4 || key.compare(length - 4, 4, ".txt") != 0) continue;
+
+		CompiledFile file;
+		file.key = key;
+
+		std::ifstream data_file(path.c_str());
+		real_t value;
+
+		while (data_file >> value) file.values.push_back(value);
+
+		if (!data_file.eof() || file.values.empty())
+		{
+			std::cerr << "[WARNING] Skipping non-numeric file - " << path << std::endl;
+			continue;
+		}
+
+		files.push_back(file);
+	}
+
+	closedir(directory);
+}
+
+inline std::uint64_t alignOffset(std::uint64_t offset, std::uint64_t alignment)
+{
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+void compilePropertyDatabase(const char *directory_name, const char *database_file_name)
+{
+	std::vector<CompiledFile> files;
+	collectDataFiles(normalizeDataPath(directory_name), "", files);
+
+	std::vector<PropertyDatabase::Entry> entries(files.size());
+
+	// Payload layout - entries, keys and then values aligned for real_t
+	std::uint64_t offset = files.size() * sizeof(PropertyDatabase::Entry);
+
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		entries[i].key_offset	= offset;
+		entries[i].key_length	= files[i].key.length();
+
+		offset += files[i].key.length();
+	}
+
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		offset = alignOffset(offset, sizeof(real_t));
+
+		entries[i].values_offset	= offset;
+		entries[i].number_of_values	= files[i].values.size();
+
+		offset += files[i].values.size() * sizeof(real_t);
+	}
+
+	static_assert(sizeof(PropertyDatabase::Header) % sizeof(real_t) == 0, "Header must preserve alignment of real_t");
+
+	std::vector<char> payload(offset, 0);
+
+	std::memcpy(payload.data(), entries.data(), files.size() * sizeof(PropertyDatabase::Entry));
+
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		std::memcpy(payload.data() + entries[i].key_offset, files[i].key.data(), files[i].key.length());
+		std::memcpy(payload.data() + entries[i].values_offset, files[i].values.data(), files[i].values.size() * sizeof(real_t));
+	}
+
+	PropertyDatabase::Header header;
+
+	std::memcpy(header.magic, PROPERTY_DATABASE_MAGIC, sizeof(PROPERTY_DATABASE_MAGIC));
+
+	header.version				= PROPERTY_DATABASE_VERSION;
+	header.real_size			= sizeof(real_t);
+	header.number_of_entries	= files.size();
+	header.payload_size			= payload.size();
+	header.checksum				= calcChecksum(payload.data(), payload.size());
+	header.reserved				= 0;
+
+	std::ofstream database_file(database_file_name, std::ios::binary);
+
+	if (database_file.fail())
+	{
+		std::cerr << "[ERROR] Could not create file - " << database_file_name << std::endl;
+		std::abort();
+	}
+
+	database_file.write((const char *) &header, sizeof(header));
+	database_file.write(payload.data(), payload.size());
+	database_file.close();
+
+	std::cout << "Compiled " << files.size() << " files from " << directory_name << " to " << database_file_name << std::endl;
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <utilities/Read-Data.hpp>
+#include <utilities/Property-Database.hpp>
 
 #include <iostream>
 #include <cstring>
@@ -23,11 +24,70 @@ void openFile(std::ifstream &file, const char * directory_name, const char *file
 	file.seekg(0, std::ios::beg);
 }
 
+// Reads number_of_values values from the file in the directory, or from the
+// compiled property database when one is loaded
+void readValues(const char * directory_name, const char *file_name, real_t *values, size_t number_of_values)
+{
+	const PropertyDatabase * database = PropertyDatabase::getLoadedDatabase();
+
+	if (database != NULL)
+	{
+		size_t number_of_compiled_values = 0;
+		const real_t * compiled_values = database->getValues(directory_name, file_name, number_of_compiled_values);
+
+		if (compiled_values == NULL || number_of_compiled_values < number_of_values)
+		{
+			std::cerr << "[ERROR] Could not find " << number_of_values << " values for file - ";
+			std::cerr << normalizeDataPath(directory_name, file_name) << " in property database" << std::endl;
+			std::abort();
+		}
+
+		std::memcpy(values, compiled_values, number_of_values * sizeof(real_t));
+
+		return;
+	}
+
+	std::ifstream file;
+	openFile(file, directory_name, file_name);
+
+	for (size_t i = 0; i < number_of_values; i++) file >> values[i];
+
+	file.close();
+}
+
+bool fileExists(const char * directory_name, const char *file_name)
+{
+	const PropertyDatabase * database = PropertyDatabase::getLoadedDatabase();
+
+	if (database != NULL)
+	{
+		size_t number_of_values;
+		return database->getValues(directory_name, file_name, number_of_values) != NULL;
+	}
+
+	char file_name_concat[_POSIX_PATH_MAX];
+	std::strcpy(file_name_concat, directory_name);
+	std::strcat(file_name_concat, "/");
+	std::strcat(file_name_concat, file_name);
+
+	std::ifstream file(file_name_concat);
+
+	return file.good();
+}
+
 template<typename data_t>
 data_t readScalarData(const char *directory_name, const char *file_name)
 {
 	data_t scalar_val;
 
+	if (PropertyDatabase::getLoadedDatabase() != NULL)
+	{
+		real_t value;
+		readValues(directory_name, file_name, &value, 1);
+
+		return (data_t) value;
+	}
+
 	std::ifstream scalar_file;
 	openFile(scalar_file, directory_name, file_name);
 	
@@ -44,30 +104,25 @@ template long double readScalarData<long double>(const char *directory_name, con
 
 ShomateExpression readShomateExpressionCoefficients(const char *directory_name)
 {
-	std::ifstream enthalpy_file;
-	openFile(enthalpy_file, directory_name, "enthalpy.txt");
-
-	real_t A, B, C, D, E, F;
-
-	enthalpy_file >> A >> B >> C >> D >> E >> F;
-
-	enthalpy_file.close();
-
-	return ShomateExpression(A, B, C, D, E, F);
+	real_t coefficients[6];
+	readValues(directory_name, "enthalpy.txt", coefficients, 6);
+
+	return ShomateExpression(
+		coefficients[0],
+		coefficients[1],
+		coefficients[2],
+		coefficients[3],
+		coefficients[4],
+		coefficients[5]
+	);
 }
 
 QuadraticExpression readQuadraticExpressionCoefficients(const char *directory_name)
 {
-	std::ifstream thermal_conductivity_file;
-	openFile(thermal_conductivity_file, directory_name, "thermal-conductivity.txt");
-
-	real_t a_0, a_1, a_2;
-
-	thermal_conductivity_file >> a_0 >> a_1 >> a_2;
-
-	thermal_conductivity_file.close();
+	real_t coefficients[3];
+	readValues(directory_name, "thermal-conductivity.txt", coefficients, 3);
 
-	return QuadraticExpression(a_0, a_1, a_2);
+	return QuadraticExpression(coefficients[0], coefficients[1], coefficients[2]);
 }
 
 IdealGas readIdealGasData(const char *directory_name)
@@ -78,24 +133,31 @@ IdealGas readIdealGasData(const char *directory_name)
 	ShomateExpression	enthalpy = readShomateExpressionCoefficients(directory_name);
 	QuadraticExpression thermal_conductivity = readQuadraticExpressionCoefficients(directory_name);
 	
-	return IdealGas(
+	IdealGas ideal_gas(
 		molar_mass,
 		gamma,
 		enthalpy,
 		thermal_conductivity
 	);
+
+	// Property table is optional, the expressions are evaluated directly if absent
+	if (fileExists(directory_name, "property-table.txt"))
+	{
+		real_t table_parameters[3];
+		readValues(directory_name, "property-table.txt", table_parameters, 3);
+
+		ideal_gas.setUpPropertyTable(table_parameters[0], table_parameters[1], table_parameters[2]);
+	}
+
+	return ideal_gas;
 }
 
-Phase readPhaseData(const char *directory_name)
+Phase readPhaseData(const char *directory_name, real_t sharpness_coefficient)
 {
 	real_t density = readScalarData<real_t>(directory_name, "density.txt");
 	
-	std::ifstream temperature_bounds_file;
-	openFile(temperature_bounds_file, directory_name, "temperature-bounds.txt");
-	
-	real_t temperature_lower_bound, temperature_upper_bound;
-	temperature_bounds_file >> temperature_lower_bound >> temperature_upper_bound;
-	temperature_bounds_file.close();
+	real_t temperature_bounds[2];
+	readValues(directory_name, "temperature-bounds.txt", temperature_bounds, 2);
 
 	ShomateExpression	enthalpy = readShomateExpressionCoefficients(directory_name);
 	QuadraticExpression	thermal_conductivity = readQuadraticExpressionCoefficients(directory_name);
@@ -104,37 +166,55 @@ Phase readPhaseData(const char *directory_name)
 		density,
 		enthalpy,
 		thermal_conductivity,
-		temperature_lower_bound,
-		temperature_upper_bound
+		sharpness_coefficient,
+		temperature_bounds[0],
+		temperature_bounds[1]
 	);
 }
 
-CondensedSpecies readCondensedSpeciesData(const char *directory_name)
+CondensedSpecies readCondensedSpeciesData(const char *directory_name, real_t sharpness_coefficient)
 {
 	char phase_directory_name[10][_POSIX_PATH_MAX];
 	unsigned int n = 0;
 
-	DIR* directory = opendir(directory_name);
-	dirent* dirent_p;
+	const PropertyDatabase * database = PropertyDatabase::getLoadedDatabase();
 
-	while ((dirent_p = readdir(directory)) != NULL && n < 10)
+	if (database != NULL)
 	{
-		if (!strcmp(dirent_p->d_name, ".") || !strcmp(dirent_p->d_name, "..")) continue;
-		if (dirent_p->d_type != DT_DIR) continue;
-
-		std::strcpy(phase_directory_name[n], directory_name);
-		std::strcat(phase_directory_name[n], "/");
-		std::strcat(phase_directory_name[n], dirent_p->d_name);
-		n++;
+		std::vector<std::string> sub_directories = database->getSubDirectories(directory_name);
+
+		for (; n < sub_directories.size() && n < 10; n++)
+		{
+			std::strcpy(phase_directory_name[n], directory_name);
+			std::strcat(phase_directory_name[n], "/");
+			std::strcat(phase_directory_name[n], sub_directories[n].c_str());
+		}
 	}
 
-	closedir(directory);
+	else
+	{
+		DIR* directory = opendir(directory_name);
+		dirent* dirent_p;
+
+		while ((dirent_p = readdir(directory)) != NULL && n < 10)
+		{
+			if (!strcmp(dirent_p->d_name, ".") || !strcmp(dirent_p->d_name, "..")) continue;
+			if (dirent_p->d_type != DT_DIR) continue;
+
+			std::strcpy(phase_directory_name[n], directory_name);
+			std::strcat(phase_directory_name[n], "/");
+			std::strcat(phase_directory_name[n], dirent_p->d_name);
+			n++;
+		}
+
+		closedir(directory);
+	}
 
 	Phase *phases = (Phase*) malloc(n * sizeof(Phase));
 
 	for (unsigned int i = 0; i < n; i++)
 	{
-		Phase phase = readPhaseData(phase_directory_name[i]);
+		Phase phase = readPhaseData(phase_directory_name[i], sharpness_coefficient);
 		memcpy(phases + i, &phase, sizeof(Phase));
 	}
 
@@ -153,15 +233,15 @@ ArrheniusDiffusivityModel readArrheniusDiffusivityModelParameters(const char *di
 	
 	t_C = readScalarData<real_t>(directory_name, "critical-temperature.txt");
 
-	std::ifstream param_file;
+	real_t parameters[2];
 	
-	openFile(param_file, directory_name, "pre-exponential-factor.txt");
-	param_file >> pre_exp_low >> pre_exp_high;
-	param_file.close();
+	readValues(directory_name, "pre-exponential-factor.txt", parameters, 2);
+	pre_exp_low		= parameters[0];
+	pre_exp_high	= parameters[1];
 
-	openFile(param_file, directory_name, "activation-energy.txt");
-	param_file >> act_eng_low >> act_eng_high;
-	param_file.close();
+	readValues(directory_name, "activation-energy.txt", parameters, 2);
+	act_eng_low		= parameters[0];
+	act_eng_high	= parameters[1];
 
 	return ArrheniusDiffusivityModel(
 		t_C,
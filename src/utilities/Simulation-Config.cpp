@@ -0,0 +1,168 @@
+/**
+ * @file Simulation-Config.cpp
+ * @brief Reads the runtime configuration of a pellet combustion simulation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Simulation-Config.hpp"
+#include "utilities/Read-Data.hpp"
+
+#include <cmath>	// PI and pow()
+#include <string>
+#include <cstring>
+
+// Returns volume of core of core-shell particle in m^3
+inline real_t calcCoreVolume(real_t core_radius)
+{
+	return 4.0 * M_PI * std::pow(core_radius, 3) / 3.0;
+}
+
+// Returns volume of shell of core-shell particle in m^3
+inline real_t calcShellVolume(real_t core_radius, real_t overall_radius)
+{
+	return 4.0 * M_PI * (std::pow(overall_radius, 3) - std::pow(core_radius, 3)) / 3.0;
+}
+
+// Joins directory and sub-directory names
+inline std::string joinPath(const char *directory_name, const char *sub_directory_name)
+{
+	return std::string(directory_name) + "/" + sub_directory_name;
+}
+
+// Member initialization follows the order of declaration,
+// members initialized later are dependent on members initialized first
+SimulationConfig::SimulationConfig(
+	const char *particle_directory,
+	const char *pellet_directory,
+	const char *solver_directory,
+	const char *diffusivity_directory
+) :	sharpness_coefficient(readScalarData<real_t>(particle_directory, "sharpness-coefficient.txt")),
+
+	core_species	(readCondensedSpeciesData(joinPath(particle_directory, "core-species").c_str(),		sharpness_coefficient)),
+	shell_species	(readCondensedSpeciesData(joinPath(particle_directory, "shell-species").c_str(),	sharpness_coefficient)),
+	product_species	(readCondensedSpeciesData(joinPath(particle_directory, "product-species").c_str(),	sharpness_coefficient)),
+
+	diffusivity_model(readArrheniusDiffusivityModelParameters(
+		diffusivity_directory != NULL ? diffusivity_directory : joinPath(particle_directory, "diffusivity-parameters").c_str()
+	)),
+
+	overall_radius	(readScalarData<real_t>(particle_directory, "overall-radius.txt")),
+	core_radius		(readScalarData<real_t>(particle_directory, "core-radius.txt")),
+
+	core_mass		(core_species.getDensity(298.15)  * calcCoreVolume(core_radius)),
+	shell_mass		(shell_species.getDensity(298.15) * calcShellVolume(core_radius, overall_radius)),
+	particle_mass	(core_mass + shell_mass),
+
+	length		(readScalarData<real_t>(pellet_directory, "length.txt")),
+	diameter	(readScalarData<real_t>(pellet_directory, "diameter.txt")),
+
+	convective_heat_transfer_coefficient_curved_surface	(readScalarData<real_t>(pellet_directory, "convective-heat-transfer-coefficient-curved-surface.txt")),
+	convective_heat_transfer_coefficient_flat_surface	(readScalarData<real_t>(pellet_directory, "convective-heat-transfer-coefficient-flat-surface.txt")),
+	radiative_emissivity								(readScalarData<real_t>(pellet_directory, "radiative-emissivity.txt")),
+
+	ambient_pressure	(readScalarData<real_t>(pellet_directory, "ambient-pressure.txt")),
+	ambient_temperature	(readScalarData<real_t>(pellet_directory, "ambient-temperature.txt")),
+
+	interstitial_gas(readIdealGasData(joinPath(pellet_directory, "interstitial-gas").c_str())),
+
+	kappa(readScalarData<real_t>(solver_directory, "kappa.txt")),
+	gamma(readScalarData<real_t>(solver_directory, "gamma.txt")),
+
+	delta_t(readScalarData<real_t>(solver_directory, "delta_t.txt")),
+	delta_T(readScalarData<real_t>(solver_directory, "delta_T.txt")),
+
+	m		(readScalarData<real_t>(solver_directory, "number-of-grid-points-pellet.txt")),
+	delta_x	(length / ((real_t) m - 1.)),
+
+	n		(readScalarData<size_t>(solver_directory, "number-of-grid-points-particle.txt")),
+	delta_r	(overall_radius / ((real_t) n - 1))
+{
+	_radial_coordinate_sqr			= new real_t[n];
+	_radial_coordinate_sqr_ratio	= new real_t[n];
+
+	for (size_t i = 0; i < n; i++)		_radial_coordinate_sqr[i] = std::pow(delta_r * (real_t) i, 2);
+
+	for (size_t i = 1; i < n-1; i++)	_radial_coordinate_sqr_ratio[i] = _radial_coordinate_sqr[i+1] / _radial_coordinate_sqr[i];
+}
+
+// Folds value into a FNV-1a hash. Long doubles are folded as the
+// nearest double and the remainder to avoid hashing padding bytes.
+inline void hashValue(std::uint64_t &hash, real_t value)
+{
+	double parts[2] = {(double) value, (double) (value - (double) value)};
+
+	unsigned char bytes[sizeof(parts)];
+	std::memcpy(bytes, parts, sizeof(parts));
+
+	for (size_t i = 0; i < sizeof(bytes); i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+}
+
+inline void hashValue(std::uint64_t &hash, const PropertyBundle &properties)
+{
+	hashValue(hash, properties.density);
+	hashValue(hash, properties.enthalpy);
+	hashValue(hash, properties.heat_capacity);
+	hashValue(hash, properties.thermal_conductivity);
+}
+
+std::uint64_t SimulationConfig::getHash() const
+{
+	std::uint64_t hash = 14695981039346656037ULL;
+
+	hashValue(hash, sharpness_coefficient);
+
+	hashValue(hash, core_species.molar_mass);
+	hashValue(hash, shell_species.molar_mass);
+	hashValue(hash, product_species.molar_mass);
+	hashValue(hash, interstitial_gas.molar_mass);
+
+	hashValue(hash, diffusivity_model.getCriticalTemperature());
+
+	for (real_t temperature = 250; temperature <= 4000; temperature += 50)
+	{
+		hashValue(hash, core_species.evaluateAll(temperature));
+		hashValue(hash, shell_species.evaluateAll(temperature));
+		hashValue(hash, product_species.evaluateAll(temperature));
+		hashValue(hash, interstitial_gas.evaluateAll(temperature, ambient_pressure));
+
+		hashValue(hash, diffusivity_model.getDiffusivity(temperature));
+	}
+
+	hashValue(hash, overall_radius);
+	hashValue(hash, core_radius);
+
+	hashValue(hash, length);
+	hashValue(hash, diameter);
+
+	hashValue(hash, convective_heat_transfer_coefficient_curved_surface);
+	hashValue(hash, convective_heat_transfer_coefficient_flat_surface);
+	hashValue(hash, radiative_emissivity);
+
+	hashValue(hash, ambient_pressure);
+	hashValue(hash, ambient_temperature);
+
+	hashValue(hash, kappa);
+	hashValue(hash, gamma);
+
+	hashValue(hash, delta_t);
+	hashValue(hash, delta_T);
+
+	hashValue(hash, (real_t) m);
+	hashValue(hash, (real_t) n);
+
+	return hash;
+}
+
+SimulationConfig::~SimulationConfig()
+{
+	delete [] _radial_coordinate_sqr;
+	delete [] _radial_coordinate_sqr_ratio;
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+/**
+ * @file Solver-Metrics.cpp
+ * @brief Publishes and reads solver metrics through a memory mapped file guarded by a sequence lock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Solver-Metrics.hpp"
+#include "utilities/Memory-Usage.hpp"
+
+#include <iostream>
+#include <new>		// placement new
+#include <cstring>	// memcpy, memcmp
+#include <cstdlib>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static const char SOLVER_METRICS_MAGIC[8] = {'P', 'E', 'L', 'L', 'E', 'T', 'M', 'X'};
+
+// Readers in other processes load the sequence from the same memory
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Sequence lock needs lock free 64 bit atomics");
+
+const char * getSolverStateName(SolverState state)
+{
+	switch (state)
+	{
+		case SOLVER_RUNNING		: return "running";
+		case SOLVER_COMPLETE	: return "complete";
+		case SOLVER_INTERRUPTED	: return "interrupted";
+	}
+
+	return "unknown";
+}
+
+SolverMetricsPublisher::SolverMetricsPublisher(const std::string &file_name)
+{
+	int file_descriptor = open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+	if (file_descriptor < 0 || ftruncate(file_descriptor, sizeof(SolverMetricsFile)) != 0)
+	{
+		std::cerr << "[ERROR] Could not create metrics file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	void * mapped_memory = mmap(NULL, sizeof(SolverMetricsFile), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+
+	// The mapping stays valid after the file is closed
+	close(file_descriptor);
+
+	if (mapped_memory == MAP_FAILED)
+	{
+		std::cerr << "[ERROR] Could not memory map metrics file - " << file_name << std::endl;
+		std::abort();
+	}
+
+	_file = new (mapped_memory) SolverMetricsFile();
+
+	_file->version			= SOLVER_METRICS_VERSION;
+	_file->number_of_phases	= NUMBER_OF_SOLVER_PHASES;
+	_file->pid				= getpid();
+
+	_rate_begun				= false;
+	_rate_begin_iteration	= 0;
+
+	_step_rate = 0;
+
+	_last_rss_update = std::chrono::steady_clock::now();
+
+	_rss		= getResidentSetSize();
+	_peak_rss	= getPeakResidentSetSize();
+
+	// Readers only accept the file once the magic is written
+	std::atomic_thread_fence(std::memory_order_release);
+	std::memcpy(_file->magic, SOLVER_METRICS_MAGIC, sizeof(SOLVER_METRICS_MAGIC));
+}
+
+SolverMetricsPublisher::~SolverMetricsPublisher()
+{
+	munmap(_file, sizeof(SolverMetricsFile));
+}
+
+void SolverMetricsPublisher::publish(SolverMetricsValues &values)
+{
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+	if (!_rate_begun)
+	{
+		_rate_begun				= true;
+		_rate_begin				= now;
+		_rate_begin_iteration	= values.iteration;
+	}
+
+	double rate_interval = std::chrono::duration<double>(now - _rate_begin).count();
+
+	// Rate over intervals of at least a second, so that it does not jitter between iterations
+	if (rate_interval >= 1.)
+	{
+		_step_rate = (values.iteration - _rate_begin_iteration) / rate_interval;
+
+		_rate_begin				= now;
+		_rate_begin_iteration	= values.iteration;
+	}
+
+	// Reading /proc is a system call, too slow for every iteration
+	if (std::chrono::duration<double>(now - _last_rss_update).count() >= 1. || values.state != SOLVER_RUNNING)
+	{
+		_rss		= getResidentSetSize();
+		_peak_rss	= getPeakResidentSetSize();
+
+		_last_rss_update = now;
+	}
+
+	values.step_rate	= _step_rate;
+	values.rss			= _rss;
+	values.peak_rss		= _peak_rss;
+
+	values.update_time = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	if (arePhaseTimersEnabled()) getPhaseTimes(values.phase_times);
+
+	else for (int phase = 0; phase < NUMBER_OF_SOLVER_PHASES; phase++) values.phase_times[phase] = 0;
+
+	std::uint64_t sequence = _file->sequence.load(std::memory_order_relaxed);
+
+	// Odd while writing
+	_file->sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	std::memcpy(&_file->values, &values, sizeof(values));
+
+	_file->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// A monitor watches many runs, so a file it cannot read is skipped rather than fatal
+SolverMetricsReader::SolverMetricsReader(const std::string &file_name) : _file(NULL)
+{
+	int file_descriptor = open(file_name.c_str(), O_RDONLY);
+
+	if (file_descriptor < 0)
+	{
+		std::cerr << "[WARNING] Could not open metrics file - " << file_name << std::endl;
+		return;
+	}
+
+	void * mapped_memory = MAP_FAILED;
+
+	if (lseek(file_descriptor, 0, SEEK_END) >= (off_t) sizeof(SolverMetricsFile))
+	{
+		mapped_memory = mmap(NULL, sizeof(SolverMetricsFile), PROT_READ, MAP_SHARED, file_descriptor, 0);
+	}
+
+	close(file_descriptor);
+
+	if (mapped_memory == MAP_FAILED)
+	{
+		std::cerr << "[WARNING] Could not memory map metrics file - " << file_name << std::endl;
+		return;
+	}
+
+	const SolverMetricsFile * file = (const SolverMetricsFile *) mapped_memory;
+
+	if (
+		std::memcmp(file->magic, SOLVER_METRICS_MAGIC, sizeof(SOLVER_METRICS_MAGIC)) != 0 ||
+		file->version != SOLVER_METRICS_VERSION ||
+		file->number_of_phases != NUMBER_OF_SOLVER_PHASES
+	) {
+		std::cerr << "[WARNING] Not a metrics file of this version of the solver - " << file_name << std::endl;
+
+		munmap(mapped_memory, sizeof(SolverMetricsFile));
+		return;
+	}
+
+	_file = file;
+}
+
+SolverMetricsReader::~SolverMetricsReader()
+{
+	if (_file != NULL) munmap((void *) _file, sizeof(SolverMetricsFile));
+}
+
+bool SolverMetricsReader::read(SolverMetricsValues &values) const
+{
+	// A write takes well under a microsecond, so many failed attempts
+	// mean the solver stopped in the middle of one
+	for (int attempt = 0; attempt < SOLVER_METRICS_READ_ATTEMPTS; attempt++)
+	{
+		std::uint64_t sequence = _file->sequence.load(std::memory_order_acquire);
+
+		if (sequence & 1) continue;
+
+		std::memcpy(&values, (const void *) &_file->values, sizeof(values));
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if (_file->sequence.load(std::memory_order_relaxed) == sequence) return true;
+	}
+
+	return false;
+}
\ No newline at end of file
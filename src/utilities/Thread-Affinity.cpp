@@ -0,0 +1,75 @@
+/**
+ * @file Thread-Affinity.cpp
+ * @brief Pins the threads of the OpenMP team to CPUs with sched_setaffinity
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Thread-Affinity.hpp"
+
+#include <iostream>
+#include <vector>
+
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+// CPUs the process could run on before its threads were pinned
+static cpu_set_t allowed_cpus;
+static bool threads_are_pinned = false;
+
+int pinOpenMPThreads()
+{
+	if (sched_getaffinity(0, sizeof(allowed_cpus), &allowed_cpus) != 0)
+	{
+		std::cerr << "[WARNING] Could not read the CPUs the process may run on, threads are not pinned" << std::endl;
+		return 0;
+	}
+
+	std::vector<int> cpus;
+
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) if (CPU_ISSET(cpu, &allowed_cpus)) cpus.push_back(cpu);
+
+	int threads_pinned = 0;
+
+	#pragma omp parallel default(shared) reduction(+:threads_pinned)
+	{
+		#ifdef _OPENMP
+			int thread = omp_get_thread_num();
+		#else
+			int thread = 0;
+		#endif
+
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		CPU_SET(cpus[thread % cpus.size()], &cpu_set);
+
+		// 0 sets the affinity of the calling thread
+		if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0) threads_pinned++;
+	}
+
+	if (threads_pinned == 0) std::cerr << "[WARNING] Could not pin threads to CPUs" << std::endl;
+
+	threads_are_pinned = threads_pinned > 0;
+
+	return threads_pinned;
+}
+
+UnpinnedAffinityScope::UnpinnedAffinityScope() : _unpinned(false)
+{
+	if (!threads_are_pinned) return;
+
+	if (sched_getaffinity(0, sizeof(_previous_cpus), &_previous_cpus) != 0) return;
+
+	_unpinned = sched_setaffinity(0, sizeof(allowed_cpus), &allowed_cpus) == 0;
+
+	if (!_unpinned) std::cerr << "[WARNING] Could not unpin thread, threads started now share its CPU" << std::endl;
+}
+
+UnpinnedAffinityScope::~UnpinnedAffinityScope()
+{
+	if (_unpinned) sched_setaffinity(0, sizeof(_previous_cpus), &_previous_cpus);
+}
\ No newline at end of file
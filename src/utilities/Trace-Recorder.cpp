@@ -0,0 +1,150 @@
+/**
+ * @file Trace-Recorder.cpp
+ * @brief Records per thread events of solver regions and writes them as a Chrome trace
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utilities/Trace-Recorder.hpp"
+
+#include <mutex>
+#include <vector>
+
+struct TraceEvent
+{
+	const char * name;
+
+	std::uint64_t begin;
+	std::uint64_t end;
+
+	long argument;
+};
+
+// Ring of the last events of a thread, event # k is held at k % capacity
+struct TraceBuffer
+{
+	std::vector<TraceEvent> events;
+
+	size_t number_of_recorded_events;
+};
+
+bool tracing_enabled = false;
+
+static size_t trace_buffer_capacity = 0;
+
+static std::chrono::steady_clock::time_point trace_start;
+
+// Buffers of every thread that has recorded an event, in the order the threads first did so.
+// Never freed, so that events of threads that have exited are still written.
+static std::vector<TraceBuffer *> trace_buffers;
+static std::mutex trace_buffers_mutex;
+
+static thread_local TraceBuffer * local_trace_buffer = NULL;
+
+void enableTracing(size_t events_per_thread)
+{
+	trace_buffer_capacity = events_per_thread;
+	trace_start = std::chrono::steady_clock::now();
+
+	tracing_enabled = true;
+}
+
+std::uint64_t getTraceTime()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_start).count();
+}
+
+void recordTraceEvent(const char *name, std::uint64_t begin, std::uint64_t end, long argument)
+{
+	if (local_trace_buffer == NULL)
+	{
+		// Once per thread, so that recording never reallocates
+		local_trace_buffer = new TraceBuffer();
+		local_trace_buffer->events.resize(trace_buffer_capacity);
+		local_trace_buffer->number_of_recorded_events = 0;
+
+		std::lock_guard<std::mutex> lock(trace_buffers_mutex);
+		trace_buffers.push_back(local_trace_buffer);
+	}
+
+	if (trace_buffer_capacity == 0) return;
+
+	TraceEvent &event = local_trace_buffer->events[local_trace_buffer->number_of_recorded_events % trace_buffer_capacity];
+
+	event.name		= name;
+	event.begin		= begin;
+	event.end		= end;
+	event.argument	= argument;
+
+	local_trace_buffer->number_of_recorded_events++;
+}
+
+size_t getNumberOfOverwrittenTraceEvents()
+{
+	std::lock_guard<std::mutex> lock(trace_buffers_mutex);
+
+	size_t number_of_overwritten_events = 0;
+
+	for (size_t thread = 0; thread < trace_buffers.size(); thread++)
+	{
+		if (trace_buffers[thread]->number_of_recorded_events > trace_buffer_capacity)
+		{
+			number_of_overwritten_events += trace_buffers[thread]->number_of_recorded_events - trace_buffer_capacity;
+		}
+	}
+
+	return number_of_overwritten_events;
+}
+
+// Writes nanoseconds as microseconds with three decimals, without rounding
+inline void printMicroseconds(std::ostream &output_stream, std::uint64_t nanoseconds)
+{
+	output_stream << nanoseconds / 1000 << '.';
+	output_stream << nanoseconds % 1000 / 100 << nanoseconds % 100 / 10 << nanoseconds % 10;
+}
+
+void printChromeTrace(std::ostream &output_stream)
+{
+	std::lock_guard<std::mutex> lock(trace_buffers_mutex);
+
+	output_stream << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+	for (size_t thread = 0; thread < trace_buffers.size(); thread++)
+	{
+		output_stream << (thread == 0 ? "\n" : ",\n");
+
+		output_stream << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread;
+		output_stream << ", \"args\": {\"name\": \"thread " << thread << "\"}}";
+	}
+
+	// Complete events, times in us
+	for (size_t thread = 0; thread < trace_buffers.size(); thread++)
+	{
+		const TraceBuffer &buffer = *trace_buffers[thread];
+
+		// Oldest event held, the ring has wrapped once more events were recorded than it holds
+		size_t first = buffer.number_of_recorded_events > trace_buffer_capacity ? buffer.number_of_recorded_events - trace_buffer_capacity : 0;
+
+		for (size_t k = first; k < buffer.number_of_recorded_events; k++)
+		{
+			const TraceEvent &event = buffer.events[k % trace_buffer_capacity];
+
+			output_stream << ",\n{\"name\": \"" << event.name << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << thread;
+
+			output_stream << ", \"ts\": ";
+			printMicroseconds(output_stream, event.begin);
+
+			output_stream << ", \"dur\": ";
+			printMicroseconds(output_stream, event.end - event.begin);
+
+			if (event.argument >= 0) output_stream << ", \"args\": {\"index\": " << event.argument << "}";
+
+			output_stream << "}";
+		}
+	}
+
+	output_stream << "\n]}\n";
+}
\ No newline at end of file